@@ -0,0 +1,107 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <stdint.h>
+#include "geometry.h"
+#ifdef USE_PEXT
+#include <immintrin.h>
+#endif
+
+/* Bit n of a bitboard is square n of Board.position, so bit 0 is a8 and
+ * bit 63 is h1.
+ */
+#define SQUARE_BB(square) (1ULL << (square))
+#define FILE_A 0x0101010101010101ULL
+#define FILE_H 0x8080808080808080ULL
+#define RANK_8 0x00000000000000FFULL
+#define RANK_1 0xFF00000000000000ULL
+
+/* Attack table lookup data for a sliding piece on one square. The occupied
+ * squares under mask are turned into an index into attacks, either with
+ * PEXT or by a magic multiply.
+ */
+typedef struct
+{
+    uint64_t mask;
+    uint64_t magic;
+    uint64_t* attacks;
+    int shift;
+} Magic;
+
+extern Magic rook_magics[64];
+extern Magic bishop_magics[64];
+
+/* Returns the index of the lowest set square and clears it from bb */
+static inline int pop_lsb(uint64_t* bb)
+{
+    int square = __builtin_ctzll(*bb);
+    *bb &= *bb - 1;
+    return square;
+}
+
+/* Moves every square of bb one rank forwards for color, up the board for
+ * white. A constant color folds into a single shift.
+ */
+static inline uint64_t shift_forward(uint64_t bb, int color)
+{
+    return (color) ? bb << 8 : bb >> 8;
+}
+
+/* Returns the squares the pawns of color capture towards the a file */
+static inline uint64_t pawn_attacks_west(uint64_t pawns, int color)
+{
+    return (shift_forward(pawns, color) >> 1) & ~FILE_H;
+}
+
+/* Returns the squares the pawns of color capture towards the h file */
+static inline uint64_t pawn_attacks_east(uint64_t pawns, int color)
+{
+    return (shift_forward(pawns, color) << 1) & ~FILE_A;
+}
+
+static inline unsigned magic_index(const Magic* m, uint64_t occupied)
+{
+#ifdef USE_PEXT
+    return _pext_u64(occupied, m->mask);
+#else
+    return ((occupied & m->mask) * m->magic) >> m->shift;
+#endif
+}
+
+/* Returns the squares a rook on square attacks given the occupied squares */
+static inline uint64_t rook_attacks(int square, uint64_t occupied)
+{
+    const Magic* m = &rook_magics[square];
+    return m->attacks[magic_index(m, occupied)];
+}
+
+/* Returns the squares a bishop on square attacks given the occupied squares */
+static inline uint64_t bishop_attacks(int square, uint64_t occupied)
+{
+    const Magic* m = &bishop_magics[square];
+    return m->attacks[magic_index(m, occupied)];
+}
+
+/* Returns the squares a knight on square attacks */
+static inline uint64_t knight_attacks(int square)
+{
+    return knight_targets[square];
+}
+
+/* Returns the squares a king on square attacks */
+static inline uint64_t king_attacks(int square)
+{
+    return king_targets[square];
+}
+
+/* Returns the squares a pawn of color on square attacks. Any non-zero color
+ * is black.
+ */
+static inline uint64_t pawn_attacks(int square, int color)
+{
+    return pawn_targets[color != 0][square];
+}
+
+void init_bitboards();
+
+#endif
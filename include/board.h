@@ -2,9 +2,7 @@
 #define BOARD_H
 
 #include <stdint.h>
-#define MAX_HISTORY 1000
-#define MAX_STORED_POSITIONS 102
-#define MAX_POSITION_STRING 82
+#define MOVES_PER_POSITION 218
 
 enum Pieces
 {
@@ -23,6 +21,16 @@ enum Color
     BLACK = 128
 };
 
+/* Indexes into Board.occupied and Board.pieces for a piece such as ROOK|BLACK */
+#define COLOR_INDEX(piece) (((piece) & 0x80) >> 7)
+#define TYPE_INDEX(piece) (__builtin_ctz((piece) & ALL_PIECES))
+
+/* Number of pieces such as ROOK|BLACK on the board, read from the material
+ * signature
+ */
+#define PIECE_COUNT(board, piece) (((board)->material_key \
+        >> (4 * (COLOR_INDEX(piece) * 6 + TYPE_INDEX(piece)))) & 0xF)
+
 /* Holds information about squares found by find_attacker() */
 typedef struct
 {
@@ -34,6 +42,28 @@ typedef struct
     int castle;
 } Found;
 
+/* Pins and checks against the king of the side to move, see get_check_info()
+ */
+typedef struct
+{
+    int king;
+    uint64_t checkers;   /* Enemy pieces giving check */
+    uint64_t check_mask; /* Squares a non-king move must land on */
+    uint64_t pinned;     /* Friendly pieces pinned to the king */
+    uint64_t danger;     /* Squares the king can not move to */
+} CheckInfo;
+
+/* What each color attacks in a position, see get_attack_map(). Squares with
+ * n attackers have bit i of n set in counts[color][i].
+ */
+typedef struct
+{
+    uint64_t key;          /* Board.hash of the position the map is for */
+    uint64_t attacked[2];  /* Squares attacked by each color */
+    uint64_t danger[2];    /* Squares each color's king can not move to */
+    uint64_t counts[2][4];
+} AttackMap;
+
 typedef struct
 {
     int8_t dest;
@@ -47,24 +77,71 @@ typedef struct
     uint8_t promotion;
 } Move;
 
+/* A move packed into 16 bits for move generation and search. Bits 0-5 hold
+ * the source square, 6-11 the destination and 12-15 the TYPE_INDEX of the
+ * promotion piece, or 0 when the move is not a promotion. Castling is a king
+ * moving two files and en passant is a pawn moving to Board.en_p, so neither
+ * needs a flag. unpack_move() converts one to a Move.
+ */
+typedef uint16_t PackedMove;
+
+#define PACK_MOVE(src, dest, promotion) \
+        ((PackedMove)((src) | ((dest) << 6) | ((promotion) << 12)))
+#define MOVE_SRC(move) ((move) & 0x3F)
+#define MOVE_DEST(move) (((move) >> 6) & 0x3F)
+#define MOVE_PROMOTION(move) ((move) >> 12)
+#define NULL_MOVE ((PackedMove)0)
+
+/* Everything make_move() changes that unmake_move() can not work out again */
+typedef struct
+{
+    uint64_t hash;
+    int8_t src;
+    int8_t dest;
+    int8_t captured_square;
+    int8_t en_p;
+    uint8_t piece;
+    uint8_t captured;
+    uint8_t castling;
+    uint8_t halfmoves;
+} Undo;
+
+/* The position on the board. It is kept to a few cache lines since search,
+ * move generation and evaluation make and take back moves on it constantly.
+ * How the game reached this position is recorded in Game.
+ */
 typedef struct 
 {
-    char white_name[100];
-    char black_name[100];
+    uint64_t hash;        /* Zobrist key, kept up to date by set_square() */
+    uint64_t pieces[6];   /* Bitboards of both colors by TYPE_INDEX */
+    uint64_t occupied[2]; /* Bitboards of every piece of each color */
+    uint64_t material_key; /* 4 bit count per color * 6 + TYPE_INDEX */
+    int16_t material[2];  /* Sum of get_value() of each color's pieces */
     uint8_t position[64];
     uint8_t to_move;
     uint8_t castling;
     int8_t en_p;
     uint8_t halfmoves;
-    uint8_t moves;
+    uint16_t moves;
     uint8_t wking_pos;
     uint8_t bking_pos;
-    uint16_t history_count;
-    Move history[MAX_HISTORY];
-    char position_hist[MAX_STORED_POSITIONS][MAX_POSITION_STRING];
-    uint16_t pos_count;
 } Board;
 
+/* A game in progress: the current position, the players and every move that
+ * has been played. The history grows as the game goes on and is released
+ * with free_game().
+ */
+typedef struct
+{
+    Board board;
+    char white_name[100];
+    char black_name[100];
+    int history_count;
+    int history_size; /* Moves history and keys have room for */
+    Move* history;
+    uint64_t* keys;   /* Key of the position before each move */
+} Game;
+
 enum
 {
     FLIPPED   = 0x001,
@@ -72,31 +149,55 @@ enum
     STALEMATE = 0x004,
     FIFTY     = 0x008,
     THREEFOLD = 0x010,
-    MAXHIST   = 0x020,
-    MAXPOS    = 0x040,
     AUTOFLIP  = 0x100,
     RANDOMSIDE= 0x200,
     COMMAND   = 0x400,
     STOP      = 0x80000000
 };
 
+/* Kinds of move for generate_moves() */
+enum
+{
+    GEN_CAPTURES = 0x1,
+    GEN_QUIETS   = 0x2,
+    GEN_ALL      = 0x3
+};
+
 extern const Move default_move;
 
+void init_zobrist();
+uint64_t position_key(Board* board);
 void default_board(Board* board);
 void empty_board(Board* board);
+void default_game(Game* game);
+void empty_game(Game* game);
+void free_game(Game* game);
+void set_square(Board* board, int square, uint8_t piece);
 void move_square(Board* board, int src, int dest);
 void move_verbose(Board* board, char* dest, char* src);
-int move_san(Board* board, char* move);
-int is_gameover(Board* board);
-int move_piece(Board* board, Move* move);
+int move_san(Game* game, char* move);
+int is_gameover(Game* game);
+int move_piece(Game* game, Move* move);
+void make_move(Board* board, Move* move, Undo* undo);
+void make_packed_move(Board* board, PackedMove move, Undo* undo);
+Move unpack_move(Board* board, PackedMove move);
+void unmake_move(Board* board, Undo* undo);
+void make_null_move(Board* board, Undo* undo);
+void unmake_null_move(Board* board, Undo* undo);
 void find_attacker(Board* board, int square, uint8_t piece, Found* founds);
+void get_check_info(Board* board, CheckInfo* info);
+const AttackMap* get_attack_map(Board* board);
+int count_attackers(Board* board, int square, int color);
+uint64_t attackers_to(Board* board, int square, uint64_t occupied);
+uint64_t piece_attacks(uint8_t piece, int square, uint64_t occupied);
+int generate_moves(Board* board, PackedMove* moves, int type);
 int is_legal(Board* board, int dest, int src);
+int castle(Board* board, int side);
 int is_attacked(Board* board, int square);
 int is_checkmate(Board* board, int which_color);
-int check_stalemate(Board* board, int which_color);
+int insufficient_material(Board* board);
+int get_piece_value(uint8_t piece);
 int get_value(Board* board, int square);
 void get_material_scores(Board* board, int* white, int* black);
 
-void stress_test(Board* board, int times);
-
 #endif
@@ -2,19 +2,30 @@
 #define ENGINE_H
 
 #include "board.h"
-#define MOVES_PER_POSITION 218
 
+/* A move being considered by the search and how promising it looks */
 typedef struct
 {
-    Move move;
-    int weight;
+    PackedMove move;
+    int16_t weight;
 } Candidate;
 
+/* Features of the selective search, all on by default */
+enum
+{
+    PRUNE_NULL_MOVE = 1,
+    PRUNE_LMR = 2,
+    PRUNE_FUTILITY = 4
+};
+
 Move Erandom_move(Board* board);
 Move Eaggressive_move(Board* board);
 Move Eape_move(Board* board);
 Move Eideal(Board* board, int protecc);
 Move Emateinone(Board* board);
-Move Econdensed(Board* board, int depth);
+Move Econdensed(Board* board, int depth, int verbose);
+void set_search_hash(int megabytes);
+void search_benchmark(int depth);
+void set_search_pruning(int feature, int on);
 
 #endif
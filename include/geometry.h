@@ -0,0 +1,49 @@
+#ifndef GEOMETRY_H
+#define GEOMETRY_H
+
+#include <stdint.h>
+
+/* Fixed facts about the board that depend only on the squares involved. The
+ * tables are generated by tools/gen_geometry.c when the program is built, so
+ * they are constant data and need no setup at startup.
+ */
+
+/* Ray directions, indexing ray_masks and the eight byte groups of ray_lists */
+enum
+{
+    RAY_UP,
+    RAY_DOWN,
+    RAY_LEFT,
+    RAY_RIGHT,
+    RAY_UPL,
+    RAY_UPR,
+    RAY_DOWNL,
+    RAY_DOWNR
+};
+
+/* Padding for lists of squares, past the edge of the board */
+#define NO_SQUARE 0x80
+
+/* Squares attacked from each square by a knight, a king, and a pawn of each
+ * COLOR_INDEX
+ */
+extern const uint64_t knight_targets[64];
+extern const uint64_t king_targets[64];
+extern const uint64_t pawn_targets[2][64];
+
+/* Squares along each ray from a square on an empty board */
+extern const uint64_t ray_masks[8][64];
+/* The same rays as lists, nearest square first and padded with NO_SQUARE,
+ * eight bytes to a ray
+ */
+extern const uint8_t ray_lists[64][64];
+/* The squares a knight on each square attacks, padded with NO_SQUARE */
+extern const uint8_t knight_lists[64][8];
+
+/* Squares strictly between two squares on a shared rank, file or diagonal,
+ * and the whole line through them. Both are empty for unaligned squares.
+ */
+extern const uint64_t between_squares[64][64];
+extern const uint64_t line_squares[64][64];
+
+#endif
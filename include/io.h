@@ -5,11 +5,12 @@
 
 void board_stats(Board* board);
 void print_board(Board* board);
-void print_fancy(Board* board);
+void print_fancy(Game* game);
 void print_flipped(Board* board);
-void print_fancy_flipped(Board* board);
+void print_fancy_flipped(Game* game);
+void print_move(PackedMove move);
 void load_fen(Board* board, char* fen);
 void export_fen(Board* board, char* fen);
-char* export_pgn(Board* board);
+char* export_pgn(Game* game);
 
 #endif
@@ -0,0 +1,14 @@
+#ifndef PERFT_H
+#define PERFT_H
+
+#include <stdint.h>
+#include "board.h"
+
+uint64_t perft(Board* board, int depth);
+uint64_t divide(Board* board, int depth);
+void run_perft(Board* board, int depth);
+int perft_suite();
+void set_perft_threads(int threads);
+void set_perft_hash(int megabytes);
+
+#endif
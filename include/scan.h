@@ -0,0 +1,11 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stdint.h>
+
+void scan_benchmark();
+#ifdef USE_SIMD_ATTACKS
+int ray_attacked(const uint8_t* position, int square, int color);
+#endif
+
+#endif
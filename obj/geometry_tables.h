@@ -0,0 +1,4094 @@
+/* Generated by tools/gen_geometry.c, do not edit */
+
+const uint64_t knight_targets[64] =
+{
+    0x0000000000020400ULL, 0x0000000000050800ULL, 0x00000000000A1100ULL,
+    0x0000000000142200ULL, 0x0000000000284400ULL, 0x0000000000508800ULL,
+    0x0000000000A01000ULL, 0x0000000000402000ULL, 0x0000000002040004ULL,
+    0x0000000005080008ULL, 0x000000000A110011ULL, 0x0000000014220022ULL,
+    0x0000000028440044ULL, 0x0000000050880088ULL, 0x00000000A0100010ULL,
+    0x0000000040200020ULL, 0x0000000204000402ULL, 0x0000000508000805ULL,
+    0x0000000A1100110AULL, 0x0000001422002214ULL, 0x0000002844004428ULL,
+    0x0000005088008850ULL, 0x000000A0100010A0ULL, 0x0000004020002040ULL,
+    0x0000020400040200ULL, 0x0000050800080500ULL, 0x00000A1100110A00ULL,
+    0x0000142200221400ULL, 0x0000284400442800ULL, 0x0000508800885000ULL,
+    0x0000A0100010A000ULL, 0x0000402000204000ULL, 0x0002040004020000ULL,
+    0x0005080008050000ULL, 0x000A1100110A0000ULL, 0x0014220022140000ULL,
+    0x0028440044280000ULL, 0x0050880088500000ULL, 0x00A0100010A00000ULL,
+    0x0040200020400000ULL, 0x0204000402000000ULL, 0x0508000805000000ULL,
+    0x0A1100110A000000ULL, 0x1422002214000000ULL, 0x2844004428000000ULL,
+    0x5088008850000000ULL, 0xA0100010A0000000ULL, 0x4020002040000000ULL,
+    0x0400040200000000ULL, 0x0800080500000000ULL, 0x1100110A00000000ULL,
+    0x2200221400000000ULL, 0x4400442800000000ULL, 0x8800885000000000ULL,
+    0x100010A000000000ULL, 0x2000204000000000ULL, 0x0004020000000000ULL,
+    0x0008050000000000ULL, 0x00110A0000000000ULL, 0x0022140000000000ULL,
+    0x0044280000000000ULL, 0x0088500000000000ULL, 0x0010A00000000000ULL,
+    0x0020400000000000ULL,
+};
+
+const uint64_t king_targets[64] =
+{
+    0x0000000000000302ULL, 0x0000000000000705ULL, 0x0000000000000E0AULL,
+    0x0000000000001C14ULL, 0x0000000000003828ULL, 0x0000000000007050ULL,
+    0x000000000000E0A0ULL, 0x000000000000C040ULL, 0x0000000000030203ULL,
+    0x0000000000070507ULL, 0x00000000000E0A0EULL, 0x00000000001C141CULL,
+    0x0000000000382838ULL, 0x0000000000705070ULL, 0x0000000000E0A0E0ULL,
+    0x0000000000C040C0ULL, 0x0000000003020300ULL, 0x0000000007050700ULL,
+    0x000000000E0A0E00ULL, 0x000000001C141C00ULL, 0x0000000038283800ULL,
+    0x0000000070507000ULL, 0x00000000E0A0E000ULL, 0x00000000C040C000ULL,
+    0x0000000302030000ULL, 0x0000000705070000ULL, 0x0000000E0A0E0000ULL,
+    0x0000001C141C0000ULL, 0x0000003828380000ULL, 0x0000007050700000ULL,
+    0x000000E0A0E00000ULL, 0x000000C040C00000ULL, 0x0000030203000000ULL,
+    0x0000070507000000ULL, 0x00000E0A0E000000ULL, 0x00001C141C000000ULL,
+    0x0000382838000000ULL, 0x0000705070000000ULL, 0x0000E0A0E0000000ULL,
+    0x0000C040C0000000ULL, 0x0003020300000000ULL, 0x0007050700000000ULL,
+    0x000E0A0E00000000ULL, 0x001C141C00000000ULL, 0x0038283800000000ULL,
+    0x0070507000000000ULL, 0x00E0A0E000000000ULL, 0x00C040C000000000ULL,
+    0x0302030000000000ULL, 0x0705070000000000ULL, 0x0E0A0E0000000000ULL,
+    0x1C141C0000000000ULL, 0x3828380000000000ULL, 0x7050700000000000ULL,
+    0xE0A0E00000000000ULL, 0xC040C00000000000ULL, 0x0203000000000000ULL,
+    0x0507000000000000ULL, 0x0A0E000000000000ULL, 0x141C000000000000ULL,
+    0x2838000000000000ULL, 0x5070000000000000ULL, 0xA0E0000000000000ULL,
+    0x40C0000000000000ULL,
+};
+
+const uint64_t pawn_targets[2][64] =
+{
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL,
+        0x0000000000000005ULL, 0x000000000000000AULL, 0x0000000000000014ULL,
+        0x0000000000000028ULL, 0x0000000000000050ULL, 0x00000000000000A0ULL,
+        0x0000000000000040ULL, 0x0000000000000200ULL, 0x0000000000000500ULL,
+        0x0000000000000A00ULL, 0x0000000000001400ULL, 0x0000000000002800ULL,
+        0x0000000000005000ULL, 0x000000000000A000ULL, 0x0000000000004000ULL,
+        0x0000000000020000ULL, 0x0000000000050000ULL, 0x00000000000A0000ULL,
+        0x0000000000140000ULL, 0x0000000000280000ULL, 0x0000000000500000ULL,
+        0x0000000000A00000ULL, 0x0000000000400000ULL, 0x0000000002000000ULL,
+        0x0000000005000000ULL, 0x000000000A000000ULL, 0x0000000014000000ULL,
+        0x0000000028000000ULL, 0x0000000050000000ULL, 0x00000000A0000000ULL,
+        0x0000000040000000ULL, 0x0000000200000000ULL, 0x0000000500000000ULL,
+        0x0000000A00000000ULL, 0x0000001400000000ULL, 0x0000002800000000ULL,
+        0x0000005000000000ULL, 0x000000A000000000ULL, 0x0000004000000000ULL,
+        0x0000020000000000ULL, 0x0000050000000000ULL, 0x00000A0000000000ULL,
+        0x0000140000000000ULL, 0x0000280000000000ULL, 0x0000500000000000ULL,
+        0x0000A00000000000ULL, 0x0000400000000000ULL, 0x0002000000000000ULL,
+        0x0005000000000000ULL, 0x000A000000000000ULL, 0x0014000000000000ULL,
+        0x0028000000000000ULL, 0x0050000000000000ULL, 0x00A0000000000000ULL,
+        0x0040000000000000ULL,
+    },
+    {
+        0x0000000000000200ULL, 0x0000000000000500ULL, 0x0000000000000A00ULL,
+        0x0000000000001400ULL, 0x0000000000002800ULL, 0x0000000000005000ULL,
+        0x000000000000A000ULL, 0x0000000000004000ULL, 0x0000000000020000ULL,
+        0x0000000000050000ULL, 0x00000000000A0000ULL, 0x0000000000140000ULL,
+        0x0000000000280000ULL, 0x0000000000500000ULL, 0x0000000000A00000ULL,
+        0x0000000000400000ULL, 0x0000000002000000ULL, 0x0000000005000000ULL,
+        0x000000000A000000ULL, 0x0000000014000000ULL, 0x0000000028000000ULL,
+        0x0000000050000000ULL, 0x00000000A0000000ULL, 0x0000000040000000ULL,
+        0x0000000200000000ULL, 0x0000000500000000ULL, 0x0000000A00000000ULL,
+        0x0000001400000000ULL, 0x0000002800000000ULL, 0x0000005000000000ULL,
+        0x000000A000000000ULL, 0x0000004000000000ULL, 0x0000020000000000ULL,
+        0x0000050000000000ULL, 0x00000A0000000000ULL, 0x0000140000000000ULL,
+        0x0000280000000000ULL, 0x0000500000000000ULL, 0x0000A00000000000ULL,
+        0x0000400000000000ULL, 0x0002000000000000ULL, 0x0005000000000000ULL,
+        0x000A000000000000ULL, 0x0014000000000000ULL, 0x0028000000000000ULL,
+        0x0050000000000000ULL, 0x00A0000000000000ULL, 0x0040000000000000ULL,
+        0x0200000000000000ULL, 0x0500000000000000ULL, 0x0A00000000000000ULL,
+        0x1400000000000000ULL, 0x2800000000000000ULL, 0x5000000000000000ULL,
+        0xA000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+};
+
+const uint64_t ray_masks[8][64] =
+{
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL,
+        0x0000000000000002ULL, 0x0000000000000004ULL, 0x0000000000000008ULL,
+        0x0000000000000010ULL, 0x0000000000000020ULL, 0x0000000000000040ULL,
+        0x0000000000000080ULL, 0x0000000000000101ULL, 0x0000000000000202ULL,
+        0x0000000000000404ULL, 0x0000000000000808ULL, 0x0000000000001010ULL,
+        0x0000000000002020ULL, 0x0000000000004040ULL, 0x0000000000008080ULL,
+        0x0000000000010101ULL, 0x0000000000020202ULL, 0x0000000000040404ULL,
+        0x0000000000080808ULL, 0x0000000000101010ULL, 0x0000000000202020ULL,
+        0x0000000000404040ULL, 0x0000000000808080ULL, 0x0000000001010101ULL,
+        0x0000000002020202ULL, 0x0000000004040404ULL, 0x0000000008080808ULL,
+        0x0000000010101010ULL, 0x0000000020202020ULL, 0x0000000040404040ULL,
+        0x0000000080808080ULL, 0x0000000101010101ULL, 0x0000000202020202ULL,
+        0x0000000404040404ULL, 0x0000000808080808ULL, 0x0000001010101010ULL,
+        0x0000002020202020ULL, 0x0000004040404040ULL, 0x0000008080808080ULL,
+        0x0000010101010101ULL, 0x0000020202020202ULL, 0x0000040404040404ULL,
+        0x0000080808080808ULL, 0x0000101010101010ULL, 0x0000202020202020ULL,
+        0x0000404040404040ULL, 0x0000808080808080ULL, 0x0001010101010101ULL,
+        0x0002020202020202ULL, 0x0004040404040404ULL, 0x0008080808080808ULL,
+        0x0010101010101010ULL, 0x0020202020202020ULL, 0x0040404040404040ULL,
+        0x0080808080808080ULL,
+    },
+    {
+        0x0101010101010100ULL, 0x0202020202020200ULL, 0x0404040404040400ULL,
+        0x0808080808080800ULL, 0x1010101010101000ULL, 0x2020202020202000ULL,
+        0x4040404040404000ULL, 0x8080808080808000ULL, 0x0101010101010000ULL,
+        0x0202020202020000ULL, 0x0404040404040000ULL, 0x0808080808080000ULL,
+        0x1010101010100000ULL, 0x2020202020200000ULL, 0x4040404040400000ULL,
+        0x8080808080800000ULL, 0x0101010101000000ULL, 0x0202020202000000ULL,
+        0x0404040404000000ULL, 0x0808080808000000ULL, 0x1010101010000000ULL,
+        0x2020202020000000ULL, 0x4040404040000000ULL, 0x8080808080000000ULL,
+        0x0101010100000000ULL, 0x0202020200000000ULL, 0x0404040400000000ULL,
+        0x0808080800000000ULL, 0x1010101000000000ULL, 0x2020202000000000ULL,
+        0x4040404000000000ULL, 0x8080808000000000ULL, 0x0101010000000000ULL,
+        0x0202020000000000ULL, 0x0404040000000000ULL, 0x0808080000000000ULL,
+        0x1010100000000000ULL, 0x2020200000000000ULL, 0x4040400000000000ULL,
+        0x8080800000000000ULL, 0x0101000000000000ULL, 0x0202000000000000ULL,
+        0x0404000000000000ULL, 0x0808000000000000ULL, 0x1010000000000000ULL,
+        0x2020000000000000ULL, 0x4040000000000000ULL, 0x8080000000000000ULL,
+        0x0100000000000000ULL, 0x0200000000000000ULL, 0x0400000000000000ULL,
+        0x0800000000000000ULL, 0x1000000000000000ULL, 0x2000000000000000ULL,
+        0x4000000000000000ULL, 0x8000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000003ULL,
+        0x0000000000000007ULL, 0x000000000000000FULL, 0x000000000000001FULL,
+        0x000000000000003FULL, 0x000000000000007FULL, 0x0000000000000000ULL,
+        0x0000000000000100ULL, 0x0000000000000300ULL, 0x0000000000000700ULL,
+        0x0000000000000F00ULL, 0x0000000000001F00ULL, 0x0000000000003F00ULL,
+        0x0000000000007F00ULL, 0x0000000000000000ULL, 0x0000000000010000ULL,
+        0x0000000000030000ULL, 0x0000000000070000ULL, 0x00000000000F0000ULL,
+        0x00000000001F0000ULL, 0x00000000003F0000ULL, 0x00000000007F0000ULL,
+        0x0000000000000000ULL, 0x0000000001000000ULL, 0x0000000003000000ULL,
+        0x0000000007000000ULL, 0x000000000F000000ULL, 0x000000001F000000ULL,
+        0x000000003F000000ULL, 0x000000007F000000ULL, 0x0000000000000000ULL,
+        0x0000000100000000ULL, 0x0000000300000000ULL, 0x0000000700000000ULL,
+        0x0000000F00000000ULL, 0x0000001F00000000ULL, 0x0000003F00000000ULL,
+        0x0000007F00000000ULL, 0x0000000000000000ULL, 0x0000010000000000ULL,
+        0x0000030000000000ULL, 0x0000070000000000ULL, 0x00000F0000000000ULL,
+        0x00001F0000000000ULL, 0x00003F0000000000ULL, 0x00007F0000000000ULL,
+        0x0000000000000000ULL, 0x0001000000000000ULL, 0x0003000000000000ULL,
+        0x0007000000000000ULL, 0x000F000000000000ULL, 0x001F000000000000ULL,
+        0x003F000000000000ULL, 0x007F000000000000ULL, 0x0000000000000000ULL,
+        0x0100000000000000ULL, 0x0300000000000000ULL, 0x0700000000000000ULL,
+        0x0F00000000000000ULL, 0x1F00000000000000ULL, 0x3F00000000000000ULL,
+        0x7F00000000000000ULL,
+    },
+    {
+        0x00000000000000FEULL, 0x00000000000000FCULL, 0x00000000000000F8ULL,
+        0x00000000000000F0ULL, 0x00000000000000E0ULL, 0x00000000000000C0ULL,
+        0x0000000000000080ULL, 0x0000000000000000ULL, 0x000000000000FE00ULL,
+        0x000000000000FC00ULL, 0x000000000000F800ULL, 0x000000000000F000ULL,
+        0x000000000000E000ULL, 0x000000000000C000ULL, 0x0000000000008000ULL,
+        0x0000000000000000ULL, 0x0000000000FE0000ULL, 0x0000000000FC0000ULL,
+        0x0000000000F80000ULL, 0x0000000000F00000ULL, 0x0000000000E00000ULL,
+        0x0000000000C00000ULL, 0x0000000000800000ULL, 0x0000000000000000ULL,
+        0x00000000FE000000ULL, 0x00000000FC000000ULL, 0x00000000F8000000ULL,
+        0x00000000F0000000ULL, 0x00000000E0000000ULL, 0x00000000C0000000ULL,
+        0x0000000080000000ULL, 0x0000000000000000ULL, 0x000000FE00000000ULL,
+        0x000000FC00000000ULL, 0x000000F800000000ULL, 0x000000F000000000ULL,
+        0x000000E000000000ULL, 0x000000C000000000ULL, 0x0000008000000000ULL,
+        0x0000000000000000ULL, 0x0000FE0000000000ULL, 0x0000FC0000000000ULL,
+        0x0000F80000000000ULL, 0x0000F00000000000ULL, 0x0000E00000000000ULL,
+        0x0000C00000000000ULL, 0x0000800000000000ULL, 0x0000000000000000ULL,
+        0x00FE000000000000ULL, 0x00FC000000000000ULL, 0x00F8000000000000ULL,
+        0x00F0000000000000ULL, 0x00E0000000000000ULL, 0x00C0000000000000ULL,
+        0x0080000000000000ULL, 0x0000000000000000ULL, 0xFE00000000000000ULL,
+        0xFC00000000000000ULL, 0xF800000000000000ULL, 0xF000000000000000ULL,
+        0xE000000000000000ULL, 0xC000000000000000ULL, 0x8000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000001ULL, 0x0000000000000002ULL, 0x0000000000000004ULL,
+        0x0000000000000008ULL, 0x0000000000000010ULL, 0x0000000000000020ULL,
+        0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000000000000100ULL,
+        0x0000000000000201ULL, 0x0000000000000402ULL, 0x0000000000000804ULL,
+        0x0000000000001008ULL, 0x0000000000002010ULL, 0x0000000000004020ULL,
+        0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000020100ULL,
+        0x0000000000040201ULL, 0x0000000000080402ULL, 0x0000000000100804ULL,
+        0x0000000000201008ULL, 0x0000000000402010ULL, 0x0000000000000000ULL,
+        0x0000000001000000ULL, 0x0000000002010000ULL, 0x0000000004020100ULL,
+        0x0000000008040201ULL, 0x0000000010080402ULL, 0x0000000020100804ULL,
+        0x0000000040201008ULL, 0x0000000000000000ULL, 0x0000000100000000ULL,
+        0x0000000201000000ULL, 0x0000000402010000ULL, 0x0000000804020100ULL,
+        0x0000001008040201ULL, 0x0000002010080402ULL, 0x0000004020100804ULL,
+        0x0000000000000000ULL, 0x0000010000000000ULL, 0x0000020100000000ULL,
+        0x0000040201000000ULL, 0x0000080402010000ULL, 0x0000100804020100ULL,
+        0x0000201008040201ULL, 0x0000402010080402ULL, 0x0000000000000000ULL,
+        0x0001000000000000ULL, 0x0002010000000000ULL, 0x0004020100000000ULL,
+        0x0008040201000000ULL, 0x0010080402010000ULL, 0x0020100804020100ULL,
+        0x0040201008040201ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL,
+        0x0000000000000004ULL, 0x0000000000000008ULL, 0x0000000000000010ULL,
+        0x0000000000000020ULL, 0x0000000000000040ULL, 0x0000000000000080ULL,
+        0x0000000000000000ULL, 0x0000000000000204ULL, 0x0000000000000408ULL,
+        0x0000000000000810ULL, 0x0000000000001020ULL, 0x0000000000002040ULL,
+        0x0000000000004080ULL, 0x0000000000008000ULL, 0x0000000000000000ULL,
+        0x0000000000020408ULL, 0x0000000000040810ULL, 0x0000000000081020ULL,
+        0x0000000000102040ULL, 0x0000000000204080ULL, 0x0000000000408000ULL,
+        0x0000000000800000ULL, 0x0000000000000000ULL, 0x0000000002040810ULL,
+        0x0000000004081020ULL, 0x0000000008102040ULL, 0x0000000010204080ULL,
+        0x0000000020408000ULL, 0x0000000040800000ULL, 0x0000000080000000ULL,
+        0x0000000000000000ULL, 0x0000000204081020ULL, 0x0000000408102040ULL,
+        0x0000000810204080ULL, 0x0000001020408000ULL, 0x0000002040800000ULL,
+        0x0000004080000000ULL, 0x0000008000000000ULL, 0x0000000000000000ULL,
+        0x0000020408102040ULL, 0x0000040810204080ULL, 0x0000081020408000ULL,
+        0x0000102040800000ULL, 0x0000204080000000ULL, 0x0000408000000000ULL,
+        0x0000800000000000ULL, 0x0000000000000000ULL, 0x0002040810204080ULL,
+        0x0004081020408000ULL, 0x0008102040800000ULL, 0x0010204080000000ULL,
+        0x0020408000000000ULL, 0x0040800000000000ULL, 0x0080000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000010200ULL,
+        0x0000000001020400ULL, 0x0000000102040800ULL, 0x0000010204081000ULL,
+        0x0001020408102000ULL, 0x0102040810204000ULL, 0x0000000000000000ULL,
+        0x0000000000010000ULL, 0x0000000001020000ULL, 0x0000000102040000ULL,
+        0x0000010204080000ULL, 0x0001020408100000ULL, 0x0102040810200000ULL,
+        0x0204081020400000ULL, 0x0000000000000000ULL, 0x0000000001000000ULL,
+        0x0000000102000000ULL, 0x0000010204000000ULL, 0x0001020408000000ULL,
+        0x0102040810000000ULL, 0x0204081020000000ULL, 0x0408102040000000ULL,
+        0x0000000000000000ULL, 0x0000000100000000ULL, 0x0000010200000000ULL,
+        0x0001020400000000ULL, 0x0102040800000000ULL, 0x0204081000000000ULL,
+        0x0408102000000000ULL, 0x0810204000000000ULL, 0x0000000000000000ULL,
+        0x0000010000000000ULL, 0x0001020000000000ULL, 0x0102040000000000ULL,
+        0x0204080000000000ULL, 0x0408100000000000ULL, 0x0810200000000000ULL,
+        0x1020400000000000ULL, 0x0000000000000000ULL, 0x0001000000000000ULL,
+        0x0102000000000000ULL, 0x0204000000000000ULL, 0x0408000000000000ULL,
+        0x0810000000000000ULL, 0x1020000000000000ULL, 0x2040000000000000ULL,
+        0x0000000000000000ULL, 0x0100000000000000ULL, 0x0200000000000000ULL,
+        0x0400000000000000ULL, 0x0800000000000000ULL, 0x1000000000000000ULL,
+        0x2000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x8040201008040200ULL, 0x0080402010080400ULL, 0x0000804020100800ULL,
+        0x0000008040201000ULL, 0x0000000080402000ULL, 0x0000000000804000ULL,
+        0x0000000000008000ULL, 0x0000000000000000ULL, 0x4020100804020000ULL,
+        0x8040201008040000ULL, 0x0080402010080000ULL, 0x0000804020100000ULL,
+        0x0000008040200000ULL, 0x0000000080400000ULL, 0x0000000000800000ULL,
+        0x0000000000000000ULL, 0x2010080402000000ULL, 0x4020100804000000ULL,
+        0x8040201008000000ULL, 0x0080402010000000ULL, 0x0000804020000000ULL,
+        0x0000008040000000ULL, 0x0000000080000000ULL, 0x0000000000000000ULL,
+        0x1008040200000000ULL, 0x2010080400000000ULL, 0x4020100800000000ULL,
+        0x8040201000000000ULL, 0x0080402000000000ULL, 0x0000804000000000ULL,
+        0x0000008000000000ULL, 0x0000000000000000ULL, 0x0804020000000000ULL,
+        0x1008040000000000ULL, 0x2010080000000000ULL, 0x4020100000000000ULL,
+        0x8040200000000000ULL, 0x0080400000000000ULL, 0x0000800000000000ULL,
+        0x0000000000000000ULL, 0x0402000000000000ULL, 0x0804000000000000ULL,
+        0x1008000000000000ULL, 0x2010000000000000ULL, 0x4020000000000000ULL,
+        0x8040000000000000ULL, 0x0080000000000000ULL, 0x0000000000000000ULL,
+        0x0200000000000000ULL, 0x0400000000000000ULL, 0x0800000000000000ULL,
+        0x1000000000000000ULL, 0x2000000000000000ULL, 0x4000000000000000ULL,
+        0x8000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+};
+
+const uint8_t ray_lists[64][64] =
+{
+    {
+        128, 128, 128, 128, 128, 128, 128, 128,   8,  16,  24,  32,
+         40,  48,  56, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+          1,   2,   3,   4,   5,   6,   7, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,   9,  18,  27,  36,
+         45,  54,  63, 128,
+    },
+    {
+        128, 128, 128, 128, 128, 128, 128, 128,   9,  17,  25,  33,
+         41,  49,  57, 128,   0, 128, 128, 128, 128, 128, 128, 128,
+          2,   3,   4,   5,   6,   7, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+          8, 128, 128, 128, 128, 128, 128, 128,  10,  19,  28,  37,
+         46,  55, 128, 128,
+    },
+    {
+        128, 128, 128, 128, 128, 128, 128, 128,  10,  18,  26,  34,
+         42,  50,  58, 128,   1,   0, 128, 128, 128, 128, 128, 128,
+          3,   4,   5,   6,   7, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+          9,  16, 128, 128, 128, 128, 128, 128,  11,  20,  29,  38,
+         47, 128, 128, 128,
+    },
+    {
+        128, 128, 128, 128, 128, 128, 128, 128,  11,  19,  27,  35,
+         43,  51,  59, 128,   2,   1,   0, 128, 128, 128, 128, 128,
+          4,   5,   6,   7, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         10,  17,  24, 128, 128, 128, 128, 128,  12,  21,  30,  39,
+        128, 128, 128, 128,
+    },
+    {
+        128, 128, 128, 128, 128, 128, 128, 128,  12,  20,  28,  36,
+         44,  52,  60, 128,   3,   2,   1,   0, 128, 128, 128, 128,
+          5,   6,   7, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         11,  18,  25,  32, 128, 128, 128, 128,  13,  22,  31, 128,
+        128, 128, 128, 128,
+    },
+    {
+        128, 128, 128, 128, 128, 128, 128, 128,  13,  21,  29,  37,
+         45,  53,  61, 128,   4,   3,   2,   1,   0, 128, 128, 128,
+          6,   7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         12,  19,  26,  33,  40, 128, 128, 128,  14,  23, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+        128, 128, 128, 128, 128, 128, 128, 128,  14,  22,  30,  38,
+         46,  54,  62, 128,   5,   4,   3,   2,   1,   0, 128, 128,
+          7, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         13,  20,  27,  34,  41,  48, 128, 128,  15, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+        128, 128, 128, 128, 128, 128, 128, 128,  15,  23,  31,  39,
+         47,  55,  63, 128,   6,   5,   4,   3,   2,   1,   0, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         14,  21,  28,  35,  42,  49,  56, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+          0, 128, 128, 128, 128, 128, 128, 128,  16,  24,  32,  40,
+         48,  56, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+          9,  10,  11,  12,  13,  14,  15, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,   1, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  17,  26,  35,  44,
+         53,  62, 128, 128,
+    },
+    {
+          1, 128, 128, 128, 128, 128, 128, 128,  17,  25,  33,  41,
+         49,  57, 128, 128,   8, 128, 128, 128, 128, 128, 128, 128,
+         10,  11,  12,  13,  14,  15, 128, 128,   0, 128, 128, 128,
+        128, 128, 128, 128,   2, 128, 128, 128, 128, 128, 128, 128,
+         16, 128, 128, 128, 128, 128, 128, 128,  18,  27,  36,  45,
+         54,  63, 128, 128,
+    },
+    {
+          2, 128, 128, 128, 128, 128, 128, 128,  18,  26,  34,  42,
+         50,  58, 128, 128,   9,   8, 128, 128, 128, 128, 128, 128,
+         11,  12,  13,  14,  15, 128, 128, 128,   1, 128, 128, 128,
+        128, 128, 128, 128,   3, 128, 128, 128, 128, 128, 128, 128,
+         17,  24, 128, 128, 128, 128, 128, 128,  19,  28,  37,  46,
+         55, 128, 128, 128,
+    },
+    {
+          3, 128, 128, 128, 128, 128, 128, 128,  19,  27,  35,  43,
+         51,  59, 128, 128,  10,   9,   8, 128, 128, 128, 128, 128,
+         12,  13,  14,  15, 128, 128, 128, 128,   2, 128, 128, 128,
+        128, 128, 128, 128,   4, 128, 128, 128, 128, 128, 128, 128,
+         18,  25,  32, 128, 128, 128, 128, 128,  20,  29,  38,  47,
+        128, 128, 128, 128,
+    },
+    {
+          4, 128, 128, 128, 128, 128, 128, 128,  20,  28,  36,  44,
+         52,  60, 128, 128,  11,  10,   9,   8, 128, 128, 128, 128,
+         13,  14,  15, 128, 128, 128, 128, 128,   3, 128, 128, 128,
+        128, 128, 128, 128,   5, 128, 128, 128, 128, 128, 128, 128,
+         19,  26,  33,  40, 128, 128, 128, 128,  21,  30,  39, 128,
+        128, 128, 128, 128,
+    },
+    {
+          5, 128, 128, 128, 128, 128, 128, 128,  21,  29,  37,  45,
+         53,  61, 128, 128,  12,  11,  10,   9,   8, 128, 128, 128,
+         14,  15, 128, 128, 128, 128, 128, 128,   4, 128, 128, 128,
+        128, 128, 128, 128,   6, 128, 128, 128, 128, 128, 128, 128,
+         20,  27,  34,  41,  48, 128, 128, 128,  22,  31, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+          6, 128, 128, 128, 128, 128, 128, 128,  22,  30,  38,  46,
+         54,  62, 128, 128,  13,  12,  11,  10,   9,   8, 128, 128,
+         15, 128, 128, 128, 128, 128, 128, 128,   5, 128, 128, 128,
+        128, 128, 128, 128,   7, 128, 128, 128, 128, 128, 128, 128,
+         21,  28,  35,  42,  49,  56, 128, 128,  23, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+          7, 128, 128, 128, 128, 128, 128, 128,  23,  31,  39,  47,
+         55,  63, 128, 128,  14,  13,  12,  11,  10,   9,   8, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,   6, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         22,  29,  36,  43,  50,  57, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+          8,   0, 128, 128, 128, 128, 128, 128,  24,  32,  40,  48,
+         56, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         17,  18,  19,  20,  21,  22,  23, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,   9,   2, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  25,  34,  43,  52,
+         61, 128, 128, 128,
+    },
+    {
+          9,   1, 128, 128, 128, 128, 128, 128,  25,  33,  41,  49,
+         57, 128, 128, 128,  16, 128, 128, 128, 128, 128, 128, 128,
+         18,  19,  20,  21,  22,  23, 128, 128,   8, 128, 128, 128,
+        128, 128, 128, 128,  10,   3, 128, 128, 128, 128, 128, 128,
+         24, 128, 128, 128, 128, 128, 128, 128,  26,  35,  44,  53,
+         62, 128, 128, 128,
+    },
+    {
+         10,   2, 128, 128, 128, 128, 128, 128,  26,  34,  42,  50,
+         58, 128, 128, 128,  17,  16, 128, 128, 128, 128, 128, 128,
+         19,  20,  21,  22,  23, 128, 128, 128,   9,   0, 128, 128,
+        128, 128, 128, 128,  11,   4, 128, 128, 128, 128, 128, 128,
+         25,  32, 128, 128, 128, 128, 128, 128,  27,  36,  45,  54,
+         63, 128, 128, 128,
+    },
+    {
+         11,   3, 128, 128, 128, 128, 128, 128,  27,  35,  43,  51,
+         59, 128, 128, 128,  18,  17,  16, 128, 128, 128, 128, 128,
+         20,  21,  22,  23, 128, 128, 128, 128,  10,   1, 128, 128,
+        128, 128, 128, 128,  12,   5, 128, 128, 128, 128, 128, 128,
+         26,  33,  40, 128, 128, 128, 128, 128,  28,  37,  46,  55,
+        128, 128, 128, 128,
+    },
+    {
+         12,   4, 128, 128, 128, 128, 128, 128,  28,  36,  44,  52,
+         60, 128, 128, 128,  19,  18,  17,  16, 128, 128, 128, 128,
+         21,  22,  23, 128, 128, 128, 128, 128,  11,   2, 128, 128,
+        128, 128, 128, 128,  13,   6, 128, 128, 128, 128, 128, 128,
+         27,  34,  41,  48, 128, 128, 128, 128,  29,  38,  47, 128,
+        128, 128, 128, 128,
+    },
+    {
+         13,   5, 128, 128, 128, 128, 128, 128,  29,  37,  45,  53,
+         61, 128, 128, 128,  20,  19,  18,  17,  16, 128, 128, 128,
+         22,  23, 128, 128, 128, 128, 128, 128,  12,   3, 128, 128,
+        128, 128, 128, 128,  14,   7, 128, 128, 128, 128, 128, 128,
+         28,  35,  42,  49,  56, 128, 128, 128,  30,  39, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         14,   6, 128, 128, 128, 128, 128, 128,  30,  38,  46,  54,
+         62, 128, 128, 128,  21,  20,  19,  18,  17,  16, 128, 128,
+         23, 128, 128, 128, 128, 128, 128, 128,  13,   4, 128, 128,
+        128, 128, 128, 128,  15, 128, 128, 128, 128, 128, 128, 128,
+         29,  36,  43,  50,  57, 128, 128, 128,  31, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         15,   7, 128, 128, 128, 128, 128, 128,  31,  39,  47,  55,
+         63, 128, 128, 128,  22,  21,  20,  19,  18,  17,  16, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  14,   5, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         30,  37,  44,  51,  58, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         16,   8,   0, 128, 128, 128, 128, 128,  32,  40,  48,  56,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         25,  26,  27,  28,  29,  30,  31, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  17,  10,   3, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  33,  42,  51,  60,
+        128, 128, 128, 128,
+    },
+    {
+         17,   9,   1, 128, 128, 128, 128, 128,  33,  41,  49,  57,
+        128, 128, 128, 128,  24, 128, 128, 128, 128, 128, 128, 128,
+         26,  27,  28,  29,  30,  31, 128, 128,  16, 128, 128, 128,
+        128, 128, 128, 128,  18,  11,   4, 128, 128, 128, 128, 128,
+         32, 128, 128, 128, 128, 128, 128, 128,  34,  43,  52,  61,
+        128, 128, 128, 128,
+    },
+    {
+         18,  10,   2, 128, 128, 128, 128, 128,  34,  42,  50,  58,
+        128, 128, 128, 128,  25,  24, 128, 128, 128, 128, 128, 128,
+         27,  28,  29,  30,  31, 128, 128, 128,  17,   8, 128, 128,
+        128, 128, 128, 128,  19,  12,   5, 128, 128, 128, 128, 128,
+         33,  40, 128, 128, 128, 128, 128, 128,  35,  44,  53,  62,
+        128, 128, 128, 128,
+    },
+    {
+         19,  11,   3, 128, 128, 128, 128, 128,  35,  43,  51,  59,
+        128, 128, 128, 128,  26,  25,  24, 128, 128, 128, 128, 128,
+         28,  29,  30,  31, 128, 128, 128, 128,  18,   9,   0, 128,
+        128, 128, 128, 128,  20,  13,   6, 128, 128, 128, 128, 128,
+         34,  41,  48, 128, 128, 128, 128, 128,  36,  45,  54,  63,
+        128, 128, 128, 128,
+    },
+    {
+         20,  12,   4, 128, 128, 128, 128, 128,  36,  44,  52,  60,
+        128, 128, 128, 128,  27,  26,  25,  24, 128, 128, 128, 128,
+         29,  30,  31, 128, 128, 128, 128, 128,  19,  10,   1, 128,
+        128, 128, 128, 128,  21,  14,   7, 128, 128, 128, 128, 128,
+         35,  42,  49,  56, 128, 128, 128, 128,  37,  46,  55, 128,
+        128, 128, 128, 128,
+    },
+    {
+         21,  13,   5, 128, 128, 128, 128, 128,  37,  45,  53,  61,
+        128, 128, 128, 128,  28,  27,  26,  25,  24, 128, 128, 128,
+         30,  31, 128, 128, 128, 128, 128, 128,  20,  11,   2, 128,
+        128, 128, 128, 128,  22,  15, 128, 128, 128, 128, 128, 128,
+         36,  43,  50,  57, 128, 128, 128, 128,  38,  47, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         22,  14,   6, 128, 128, 128, 128, 128,  38,  46,  54,  62,
+        128, 128, 128, 128,  29,  28,  27,  26,  25,  24, 128, 128,
+         31, 128, 128, 128, 128, 128, 128, 128,  21,  12,   3, 128,
+        128, 128, 128, 128,  23, 128, 128, 128, 128, 128, 128, 128,
+         37,  44,  51,  58, 128, 128, 128, 128,  39, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         23,  15,   7, 128, 128, 128, 128, 128,  39,  47,  55,  63,
+        128, 128, 128, 128,  30,  29,  28,  27,  26,  25,  24, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  22,  13,   4, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         38,  45,  52,  59, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         24,  16,   8,   0, 128, 128, 128, 128,  40,  48,  56, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         33,  34,  35,  36,  37,  38,  39, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  25,  18,  11,   4, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  41,  50,  59, 128,
+        128, 128, 128, 128,
+    },
+    {
+         25,  17,   9,   1, 128, 128, 128, 128,  41,  49,  57, 128,
+        128, 128, 128, 128,  32, 128, 128, 128, 128, 128, 128, 128,
+         34,  35,  36,  37,  38,  39, 128, 128,  24, 128, 128, 128,
+        128, 128, 128, 128,  26,  19,  12,   5, 128, 128, 128, 128,
+         40, 128, 128, 128, 128, 128, 128, 128,  42,  51,  60, 128,
+        128, 128, 128, 128,
+    },
+    {
+         26,  18,  10,   2, 128, 128, 128, 128,  42,  50,  58, 128,
+        128, 128, 128, 128,  33,  32, 128, 128, 128, 128, 128, 128,
+         35,  36,  37,  38,  39, 128, 128, 128,  25,  16, 128, 128,
+        128, 128, 128, 128,  27,  20,  13,   6, 128, 128, 128, 128,
+         41,  48, 128, 128, 128, 128, 128, 128,  43,  52,  61, 128,
+        128, 128, 128, 128,
+    },
+    {
+         27,  19,  11,   3, 128, 128, 128, 128,  43,  51,  59, 128,
+        128, 128, 128, 128,  34,  33,  32, 128, 128, 128, 128, 128,
+         36,  37,  38,  39, 128, 128, 128, 128,  26,  17,   8, 128,
+        128, 128, 128, 128,  28,  21,  14,   7, 128, 128, 128, 128,
+         42,  49,  56, 128, 128, 128, 128, 128,  44,  53,  62, 128,
+        128, 128, 128, 128,
+    },
+    {
+         28,  20,  12,   4, 128, 128, 128, 128,  44,  52,  60, 128,
+        128, 128, 128, 128,  35,  34,  33,  32, 128, 128, 128, 128,
+         37,  38,  39, 128, 128, 128, 128, 128,  27,  18,   9,   0,
+        128, 128, 128, 128,  29,  22,  15, 128, 128, 128, 128, 128,
+         43,  50,  57, 128, 128, 128, 128, 128,  45,  54,  63, 128,
+        128, 128, 128, 128,
+    },
+    {
+         29,  21,  13,   5, 128, 128, 128, 128,  45,  53,  61, 128,
+        128, 128, 128, 128,  36,  35,  34,  33,  32, 128, 128, 128,
+         38,  39, 128, 128, 128, 128, 128, 128,  28,  19,  10,   1,
+        128, 128, 128, 128,  30,  23, 128, 128, 128, 128, 128, 128,
+         44,  51,  58, 128, 128, 128, 128, 128,  46,  55, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         30,  22,  14,   6, 128, 128, 128, 128,  46,  54,  62, 128,
+        128, 128, 128, 128,  37,  36,  35,  34,  33,  32, 128, 128,
+         39, 128, 128, 128, 128, 128, 128, 128,  29,  20,  11,   2,
+        128, 128, 128, 128,  31, 128, 128, 128, 128, 128, 128, 128,
+         45,  52,  59, 128, 128, 128, 128, 128,  47, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         31,  23,  15,   7, 128, 128, 128, 128,  47,  55,  63, 128,
+        128, 128, 128, 128,  38,  37,  36,  35,  34,  33,  32, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  30,  21,  12,   3,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         46,  53,  60, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         32,  24,  16,   8,   0, 128, 128, 128,  48,  56, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         41,  42,  43,  44,  45,  46,  47, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  33,  26,  19,  12,   5, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  49,  58, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         33,  25,  17,   9,   1, 128, 128, 128,  49,  57, 128, 128,
+        128, 128, 128, 128,  40, 128, 128, 128, 128, 128, 128, 128,
+         42,  43,  44,  45,  46,  47, 128, 128,  32, 128, 128, 128,
+        128, 128, 128, 128,  34,  27,  20,  13,   6, 128, 128, 128,
+         48, 128, 128, 128, 128, 128, 128, 128,  50,  59, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         34,  26,  18,  10,   2, 128, 128, 128,  50,  58, 128, 128,
+        128, 128, 128, 128,  41,  40, 128, 128, 128, 128, 128, 128,
+         43,  44,  45,  46,  47, 128, 128, 128,  33,  24, 128, 128,
+        128, 128, 128, 128,  35,  28,  21,  14,   7, 128, 128, 128,
+         49,  56, 128, 128, 128, 128, 128, 128,  51,  60, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         35,  27,  19,  11,   3, 128, 128, 128,  51,  59, 128, 128,
+        128, 128, 128, 128,  42,  41,  40, 128, 128, 128, 128, 128,
+         44,  45,  46,  47, 128, 128, 128, 128,  34,  25,  16, 128,
+        128, 128, 128, 128,  36,  29,  22,  15, 128, 128, 128, 128,
+         50,  57, 128, 128, 128, 128, 128, 128,  52,  61, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         36,  28,  20,  12,   4, 128, 128, 128,  52,  60, 128, 128,
+        128, 128, 128, 128,  43,  42,  41,  40, 128, 128, 128, 128,
+         45,  46,  47, 128, 128, 128, 128, 128,  35,  26,  17,   8,
+        128, 128, 128, 128,  37,  30,  23, 128, 128, 128, 128, 128,
+         51,  58, 128, 128, 128, 128, 128, 128,  53,  62, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         37,  29,  21,  13,   5, 128, 128, 128,  53,  61, 128, 128,
+        128, 128, 128, 128,  44,  43,  42,  41,  40, 128, 128, 128,
+         46,  47, 128, 128, 128, 128, 128, 128,  36,  27,  18,   9,
+          0, 128, 128, 128,  38,  31, 128, 128, 128, 128, 128, 128,
+         52,  59, 128, 128, 128, 128, 128, 128,  54,  63, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         38,  30,  22,  14,   6, 128, 128, 128,  54,  62, 128, 128,
+        128, 128, 128, 128,  45,  44,  43,  42,  41,  40, 128, 128,
+         47, 128, 128, 128, 128, 128, 128, 128,  37,  28,  19,  10,
+          1, 128, 128, 128,  39, 128, 128, 128, 128, 128, 128, 128,
+         53,  60, 128, 128, 128, 128, 128, 128,  55, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         39,  31,  23,  15,   7, 128, 128, 128,  55,  63, 128, 128,
+        128, 128, 128, 128,  46,  45,  44,  43,  42,  41,  40, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  38,  29,  20,  11,
+          2, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         54,  61, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         40,  32,  24,  16,   8,   0, 128, 128,  56, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         49,  50,  51,  52,  53,  54,  55, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  41,  34,  27,  20,  13,   6, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  57, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         41,  33,  25,  17,   9,   1, 128, 128,  57, 128, 128, 128,
+        128, 128, 128, 128,  48, 128, 128, 128, 128, 128, 128, 128,
+         50,  51,  52,  53,  54,  55, 128, 128,  40, 128, 128, 128,
+        128, 128, 128, 128,  42,  35,  28,  21,  14,   7, 128, 128,
+         56, 128, 128, 128, 128, 128, 128, 128,  58, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         42,  34,  26,  18,  10,   2, 128, 128,  58, 128, 128, 128,
+        128, 128, 128, 128,  49,  48, 128, 128, 128, 128, 128, 128,
+         51,  52,  53,  54,  55, 128, 128, 128,  41,  32, 128, 128,
+        128, 128, 128, 128,  43,  36,  29,  22,  15, 128, 128, 128,
+         57, 128, 128, 128, 128, 128, 128, 128,  59, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         43,  35,  27,  19,  11,   3, 128, 128,  59, 128, 128, 128,
+        128, 128, 128, 128,  50,  49,  48, 128, 128, 128, 128, 128,
+         52,  53,  54,  55, 128, 128, 128, 128,  42,  33,  24, 128,
+        128, 128, 128, 128,  44,  37,  30,  23, 128, 128, 128, 128,
+         58, 128, 128, 128, 128, 128, 128, 128,  60, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         44,  36,  28,  20,  12,   4, 128, 128,  60, 128, 128, 128,
+        128, 128, 128, 128,  51,  50,  49,  48, 128, 128, 128, 128,
+         53,  54,  55, 128, 128, 128, 128, 128,  43,  34,  25,  16,
+        128, 128, 128, 128,  45,  38,  31, 128, 128, 128, 128, 128,
+         59, 128, 128, 128, 128, 128, 128, 128,  61, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         45,  37,  29,  21,  13,   5, 128, 128,  61, 128, 128, 128,
+        128, 128, 128, 128,  52,  51,  50,  49,  48, 128, 128, 128,
+         54,  55, 128, 128, 128, 128, 128, 128,  44,  35,  26,  17,
+          8, 128, 128, 128,  46,  39, 128, 128, 128, 128, 128, 128,
+         60, 128, 128, 128, 128, 128, 128, 128,  62, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         46,  38,  30,  22,  14,   6, 128, 128,  62, 128, 128, 128,
+        128, 128, 128, 128,  53,  52,  51,  50,  49,  48, 128, 128,
+         55, 128, 128, 128, 128, 128, 128, 128,  45,  36,  27,  18,
+          9,   0, 128, 128,  47, 128, 128, 128, 128, 128, 128, 128,
+         61, 128, 128, 128, 128, 128, 128, 128,  63, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         47,  39,  31,  23,  15,   7, 128, 128,  63, 128, 128, 128,
+        128, 128, 128, 128,  54,  53,  52,  51,  50,  49,  48, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  46,  37,  28,  19,
+         10,   1, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         62, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         48,  40,  32,  24,  16,   8,   0, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+         57,  58,  59,  60,  61,  62,  63, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  49,  42,  35,  28,  21,  14,   7, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         49,  41,  33,  25,  17,   9,   1, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  56, 128, 128, 128, 128, 128, 128, 128,
+         58,  59,  60,  61,  62,  63, 128, 128,  48, 128, 128, 128,
+        128, 128, 128, 128,  50,  43,  36,  29,  22,  15, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         50,  42,  34,  26,  18,  10,   2, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  57,  56, 128, 128, 128, 128, 128, 128,
+         59,  60,  61,  62,  63, 128, 128, 128,  49,  40, 128, 128,
+        128, 128, 128, 128,  51,  44,  37,  30,  23, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         51,  43,  35,  27,  19,  11,   3, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  58,  57,  56, 128, 128, 128, 128, 128,
+         60,  61,  62,  63, 128, 128, 128, 128,  50,  41,  32, 128,
+        128, 128, 128, 128,  52,  45,  38,  31, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         52,  44,  36,  28,  20,  12,   4, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  59,  58,  57,  56, 128, 128, 128, 128,
+         61,  62,  63, 128, 128, 128, 128, 128,  51,  42,  33,  24,
+        128, 128, 128, 128,  53,  46,  39, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         53,  45,  37,  29,  21,  13,   5, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  60,  59,  58,  57,  56, 128, 128, 128,
+         62,  63, 128, 128, 128, 128, 128, 128,  52,  43,  34,  25,
+         16, 128, 128, 128,  54,  47, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         54,  46,  38,  30,  22,  14,   6, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  61,  60,  59,  58,  57,  56, 128, 128,
+         63, 128, 128, 128, 128, 128, 128, 128,  53,  44,  35,  26,
+         17,   8, 128, 128,  55, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+    {
+         55,  47,  39,  31,  23,  15,   7, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,  62,  61,  60,  59,  58,  57,  56, 128,
+        128, 128, 128, 128, 128, 128, 128, 128,  54,  45,  36,  27,
+         18,   9,   0, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+        128, 128, 128, 128,
+    },
+};
+
+const uint8_t knight_lists[64][8] =
+{
+    {
+        128, 128, 128, 128, 128,  10, 128,  17,
+    },
+    {
+        128, 128, 128, 128, 128,  11,  16,  18,
+    },
+    {
+        128, 128, 128, 128,   8,  12,  17,  19,
+    },
+    {
+        128, 128, 128, 128,   9,  13,  18,  20,
+    },
+    {
+        128, 128, 128, 128,  10,  14,  19,  21,
+    },
+    {
+        128, 128, 128, 128,  11,  15,  20,  22,
+    },
+    {
+        128, 128, 128, 128,  12, 128,  21,  23,
+    },
+    {
+        128, 128, 128, 128,  13, 128,  22, 128,
+    },
+    {
+        128, 128, 128,   2, 128,  18, 128,  25,
+    },
+    {
+        128, 128, 128,   3, 128,  19,  24,  26,
+    },
+    {
+        128, 128,   0,   4,  16,  20,  25,  27,
+    },
+    {
+        128, 128,   1,   5,  17,  21,  26,  28,
+    },
+    {
+        128, 128,   2,   6,  18,  22,  27,  29,
+    },
+    {
+        128, 128,   3,   7,  19,  23,  28,  30,
+    },
+    {
+        128, 128,   4, 128,  20, 128,  29,  31,
+    },
+    {
+        128, 128,   5, 128,  21, 128,  30, 128,
+    },
+    {
+        128,   1, 128,  10, 128,  26, 128,  33,
+    },
+    {
+          0,   2, 128,  11, 128,  27,  32,  34,
+    },
+    {
+          1,   3,   8,  12,  24,  28,  33,  35,
+    },
+    {
+          2,   4,   9,  13,  25,  29,  34,  36,
+    },
+    {
+          3,   5,  10,  14,  26,  30,  35,  37,
+    },
+    {
+          4,   6,  11,  15,  27,  31,  36,  38,
+    },
+    {
+          5,   7,  12, 128,  28, 128,  37,  39,
+    },
+    {
+          6, 128,  13, 128,  29, 128,  38, 128,
+    },
+    {
+        128,   9, 128,  18, 128,  34, 128,  41,
+    },
+    {
+          8,  10, 128,  19, 128,  35,  40,  42,
+    },
+    {
+          9,  11,  16,  20,  32,  36,  41,  43,
+    },
+    {
+         10,  12,  17,  21,  33,  37,  42,  44,
+    },
+    {
+         11,  13,  18,  22,  34,  38,  43,  45,
+    },
+    {
+         12,  14,  19,  23,  35,  39,  44,  46,
+    },
+    {
+         13,  15,  20, 128,  36, 128,  45,  47,
+    },
+    {
+         14, 128,  21, 128,  37, 128,  46, 128,
+    },
+    {
+        128,  17, 128,  26, 128,  42, 128,  49,
+    },
+    {
+         16,  18, 128,  27, 128,  43,  48,  50,
+    },
+    {
+         17,  19,  24,  28,  40,  44,  49,  51,
+    },
+    {
+         18,  20,  25,  29,  41,  45,  50,  52,
+    },
+    {
+         19,  21,  26,  30,  42,  46,  51,  53,
+    },
+    {
+         20,  22,  27,  31,  43,  47,  52,  54,
+    },
+    {
+         21,  23,  28, 128,  44, 128,  53,  55,
+    },
+    {
+         22, 128,  29, 128,  45, 128,  54, 128,
+    },
+    {
+        128,  25, 128,  34, 128,  50, 128,  57,
+    },
+    {
+         24,  26, 128,  35, 128,  51,  56,  58,
+    },
+    {
+         25,  27,  32,  36,  48,  52,  57,  59,
+    },
+    {
+         26,  28,  33,  37,  49,  53,  58,  60,
+    },
+    {
+         27,  29,  34,  38,  50,  54,  59,  61,
+    },
+    {
+         28,  30,  35,  39,  51,  55,  60,  62,
+    },
+    {
+         29,  31,  36, 128,  52, 128,  61,  63,
+    },
+    {
+         30, 128,  37, 128,  53, 128,  62, 128,
+    },
+    {
+        128,  33, 128,  42, 128,  58, 128, 128,
+    },
+    {
+         32,  34, 128,  43, 128,  59, 128, 128,
+    },
+    {
+         33,  35,  40,  44,  56,  60, 128, 128,
+    },
+    {
+         34,  36,  41,  45,  57,  61, 128, 128,
+    },
+    {
+         35,  37,  42,  46,  58,  62, 128, 128,
+    },
+    {
+         36,  38,  43,  47,  59,  63, 128, 128,
+    },
+    {
+         37,  39,  44, 128,  60, 128, 128, 128,
+    },
+    {
+         38, 128,  45, 128,  61, 128, 128, 128,
+    },
+    {
+        128,  41, 128,  50, 128, 128, 128, 128,
+    },
+    {
+         40,  42, 128,  51, 128, 128, 128, 128,
+    },
+    {
+         41,  43,  48,  52, 128, 128, 128, 128,
+    },
+    {
+         42,  44,  49,  53, 128, 128, 128, 128,
+    },
+    {
+         43,  45,  50,  54, 128, 128, 128, 128,
+    },
+    {
+         44,  46,  51,  55, 128, 128, 128, 128,
+    },
+    {
+         45,  47,  52, 128, 128, 128, 128, 128,
+    },
+    {
+         46, 128,  53, 128, 128, 128, 128, 128,
+    },
+};
+
+const uint64_t between_squares[64][64] =
+{
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL,
+        0x0000000000000006ULL, 0x000000000000000EULL, 0x000000000000001EULL,
+        0x000000000000003EULL, 0x000000000000007EULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000000000ULL,
+        0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001010100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000101010100ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008040200ULL, 0x0000000000000000ULL, 0x0001010101010100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201008040200ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000004ULL, 0x000000000000000CULL, 0x000000000000001CULL,
+        0x000000000000003CULL, 0x000000000000007CULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000200ULL,
+        0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202020200ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020202020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010080400ULL, 0x0000000000000000ULL,
+        0x0002020202020200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000008ULL, 0x0000000000000018ULL,
+        0x0000000000000038ULL, 0x0000000000000078ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL,
+        0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000004040400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000404040400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040404040400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000006ULL, 0x0000000000000004ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000010ULL,
+        0x0000000000000030ULL, 0x0000000000000070ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+        0x0000000000000000ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+        0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000201000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040201000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000808080800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080808080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x000000000000000EULL, 0x000000000000000CULL, 0x0000000000000008ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000020ULL, 0x0000000000000060ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000800ULL, 0x0000000000000000ULL, 0x0000000000001000ULL,
+        0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000040800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000402000ULL, 0x0000000002040800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001010101000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101010101000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x000000000000001EULL, 0x000000000000001CULL, 0x0000000000000018ULL,
+        0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000000000ULL,
+        0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000081000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004081000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000020202000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000204081000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000002020202000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202020202000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x000000000000003EULL, 0x000000000000003CULL, 0x0000000000000038ULL,
+        0x0000000000000030ULL, 0x0000000000000020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL,
+        0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008102000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040404000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408102000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000004040404000ULL, 0x0000000000000000ULL,
+        0x0000020408102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404040404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040404000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x000000000000007EULL, 0x000000000000007CULL, 0x0000000000000078ULL,
+        0x0000000000000070ULL, 0x0000000000000060ULL, 0x0000000000000040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000008000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000204000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010204000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000080808000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000810204000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080808000ULL,
+        0x0000000000000000ULL, 0x0000040810204000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808080808000ULL, 0x0002040810204000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808080808000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000600ULL,
+        0x0000000000000E00ULL, 0x0000000000001E00ULL, 0x0000000000003E00ULL,
+        0x0000000000007E00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000101010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010101010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010101010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100804020000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+        0x0000000000000C00ULL, 0x0000000000001C00ULL, 0x0000000000003C00ULL,
+        0x0000000000007C00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+        0x0000000000040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020202020000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201008040000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000200ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000800ULL, 0x0000000000001800ULL, 0x0000000000003800ULL,
+        0x0000000000007800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL,
+        0x0000000000000000ULL, 0x0000000000080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000004040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000404040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040404040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000600ULL,
+        0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000003000ULL,
+        0x0000000000007000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL,
+        0x0000000000080000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000808080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080808080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000E00ULL,
+        0x0000000000000C00ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL,
+        0x0000000000006000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL,
+        0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+        0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040200000ULL, 0x0000000204080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001010100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101010100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000001E00ULL,
+        0x0000000000001C00ULL, 0x0000000000001800ULL, 0x0000000000001000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL,
+        0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000002020200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020408100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202020200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000003E00ULL,
+        0x0000000000003C00ULL, 0x0000000000003800ULL, 0x0000000000003000ULL,
+        0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+        0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000810200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000004040400000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040810200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404040400000ULL, 0x0000000000000000ULL, 0x0002040810200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040400000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000007E00ULL,
+        0x0000000000007C00ULL, 0x0000000000007800ULL, 0x0000000000007000ULL,
+        0x0000000000006000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+        0x0000000000000000ULL, 0x0000000000800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001020400000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081020400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808080800000ULL, 0x0000000000000000ULL,
+        0x0004081020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808080800000ULL,
+    },
+    {
+        0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000200ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020000ULL, 0x0000000000060000ULL, 0x00000000000E0000ULL,
+        0x00000000001E0000ULL, 0x00000000003E0000ULL, 0x00000000007E0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001000000ULL,
+        0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000101000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010101000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010101000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000200ULL, 0x0000000000000000ULL,
+        0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000040000ULL, 0x00000000000C0000ULL,
+        0x00000000001C0000ULL, 0x00000000003C0000ULL, 0x00000000007C0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020202000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020202000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100804000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+        0x0000000000000000ULL, 0x0000000000000800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL,
+        0x0000000000180000ULL, 0x0000000000380000ULL, 0x0000000000780000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL,
+        0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+        0x0000000008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000404000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040404000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201008000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000400ULL, 0x0000000000000000ULL,
+        0x0000000000000800ULL, 0x0000000000000000ULL, 0x0000000000001000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000060000ULL, 0x0000000000040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000100000ULL, 0x0000000000300000ULL, 0x0000000000700000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL,
+        0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000204000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000808000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080808000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000800ULL,
+        0x0000000000000000ULL, 0x0000000000001000ULL, 0x0000000000000000ULL,
+        0x0000000000002000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000000E0000ULL, 0x00000000000C0000ULL,
+        0x0000000000080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000600000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+        0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001010000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020000000ULL,
+        0x0000020408000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000001000ULL, 0x0000000000000000ULL, 0x0000000000002000ULL,
+        0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000001E0000ULL, 0x00000000001C0000ULL,
+        0x0000000000180000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010000000ULL,
+        0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL,
+        0x0000000040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000002020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040810000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202020000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040810000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000002000ULL, 0x0000000000000000ULL,
+        0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000003E0000ULL, 0x00000000003C0000ULL,
+        0x0000000000380000ULL, 0x0000000000300000ULL, 0x0000000000200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000004040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081020000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004081020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000004000ULL,
+        0x0000000000000000ULL, 0x0000000000008000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000007E0000ULL, 0x00000000007C0000ULL,
+        0x0000000000780000ULL, 0x0000000000700000ULL, 0x0000000000600000ULL,
+        0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+        0x0000000080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000102040000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008102040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808080000000ULL,
+    },
+    {
+        0x0000000000010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000010000ULL,
+        0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL,
+        0x0000000006000000ULL, 0x000000000E000000ULL, 0x000000001E000000ULL,
+        0x000000003E000000ULL, 0x000000007E000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000100000000ULL, 0x0000000000000000ULL,
+        0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000040800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000020000ULL, 0x0000000000000000ULL, 0x0000000000040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004000000ULL, 0x000000000C000000ULL, 0x000000001C000000ULL,
+        0x000000003C000000ULL, 0x000000007C000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+        0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020200000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000081000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL,
+        0x0000000000000000ULL, 0x0000000000040000ULL, 0x0000000000000000ULL,
+        0x0000000000080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000018000000ULL,
+        0x0000000038000000ULL, 0x0000000078000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL,
+        0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040400000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100800000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000040000ULL, 0x0000000000000000ULL, 0x0000000000080000ULL,
+        0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000006000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010000000ULL,
+        0x0000000030000000ULL, 0x0000000070000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+        0x0000000000000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+        0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000204000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000080000ULL, 0x0000000000000000ULL,
+        0x0000000000100000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000000E000000ULL, 0x000000000C000000ULL, 0x0000000008000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000020000000ULL, 0x0000000060000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000800000000ULL, 0x0000000000000000ULL, 0x0000001000000000ULL,
+        0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402000000000ULL, 0x0002040800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+        0x0000000000000000ULL, 0x0000000000200000ULL, 0x0000000000000000ULL,
+        0x0000000000400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000001E000000ULL, 0x000000001C000000ULL, 0x0000000018000000ULL,
+        0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL,
+        0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004081000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000201000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000200000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000003E000000ULL, 0x000000003C000000ULL, 0x0000000038000000ULL,
+        0x0000000030000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL,
+        0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000102000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008102000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000402000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000400000ULL, 0x0000000000000000ULL,
+        0x0000000000800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000007E000000ULL, 0x000000007C000000ULL, 0x0000000078000000ULL,
+        0x0000000070000000ULL, 0x0000000060000000ULL, 0x0000000040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000008000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000204000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010204000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808000000000ULL,
+    },
+    {
+        0x0000000001010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000002040800ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002040000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000001000000ULL, 0x0000000000000000ULL,
+        0x0000000002000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000600000000ULL,
+        0x0000000E00000000ULL, 0x0000001E00000000ULL, 0x0000003E00000000ULL,
+        0x0000007E00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004020000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000002020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004081000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000002020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000004080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL,
+        0x0000000000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+        0x0000000C00000000ULL, 0x0000001C00000000ULL, 0x0000003C00000000ULL,
+        0x0000007C00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+        0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000004040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000008100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL,
+        0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000800000000ULL, 0x0000001800000000ULL, 0x0000003800000000ULL,
+        0x0000007800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL,
+        0x0000000000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010204000ULL, 0x0000000004020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000004000000ULL,
+        0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+        0x0000000010000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000600000000ULL,
+        0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000003000000000ULL,
+        0x0000007000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL,
+        0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000100000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000008000000ULL, 0x0000000000000000ULL, 0x0000000010000000ULL,
+        0x0000000000000000ULL, 0x0000000020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000E00000000ULL,
+        0x0000000C00000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL,
+        0x0000006000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL,
+        0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL,
+        0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040200000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL,
+        0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001E00000000ULL,
+        0x0000001C00000000ULL, 0x0000001800000000ULL, 0x0000001000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000100000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL,
+        0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008100000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020200000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL,
+        0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000003E00000000ULL,
+        0x0000003C00000000ULL, 0x0000003800000000ULL, 0x0000003000000000ULL,
+        0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000000000000000ULL,
+        0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010200000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040400000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040201000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040200000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000040000000ULL, 0x0000000000000000ULL, 0x0000000080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000007E00000000ULL,
+        0x0000007C00000000ULL, 0x0000007800000000ULL, 0x0000007000000000ULL,
+        0x0000006000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+        0x0000000000000000ULL, 0x0000800000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080800000000000ULL,
+    },
+    {
+        0x0000000101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000204081000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000101010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000204080000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000101000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000204000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020000000000ULL, 0x0000060000000000ULL, 0x00000E0000000000ULL,
+        0x00001E0000000000ULL, 0x00003E0000000000ULL, 0x00007E0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001000000000000ULL,
+        0x0000000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000202020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000408102000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000408100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000202000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000408000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL,
+        0x0000000400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040000000000ULL, 0x00000C0000000000ULL,
+        0x00001C0000000000ULL, 0x00003C0000000000ULL, 0x00007C0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000404040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000810204000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000404040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000810200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000404000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000400000000ULL,
+        0x0000000000000000ULL, 0x0000000800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL,
+        0x0000180000000000ULL, 0x0000380000000000ULL, 0x0000780000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL,
+        0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+        0x0008000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000808080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000808080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001020400000ULL, 0x0000000402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000808000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000400000000ULL, 0x0000000000000000ULL,
+        0x0000000800000000ULL, 0x0000000000000000ULL, 0x0000001000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000060000000000ULL, 0x0000040000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000100000000000ULL, 0x0000300000000000ULL, 0x0000700000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004000000000000ULL, 0x0000000000000000ULL, 0x0008000000000000ULL,
+        0x0000000000000000ULL, 0x0010000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000001010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000001010000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000800000000ULL,
+        0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL,
+        0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000E0000000000ULL, 0x00000C0000000000ULL,
+        0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000600000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008000000000000ULL, 0x0000000000000000ULL,
+        0x0010000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000001008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000002020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL,
+        0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00001E0000000000ULL, 0x00001C0000000000ULL,
+        0x0000180000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL,
+        0x0000000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL,
+        0x0040000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000002010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000004040404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000004040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL,
+        0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00003E0000000000ULL, 0x00003C0000000000ULL,
+        0x0000380000000000ULL, 0x0000300000000000ULL, 0x0000200000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100800ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000008080808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020100000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004020000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000008080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+        0x0000000000000000ULL, 0x0000008000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00007E0000000000ULL, 0x00007C0000000000ULL,
+        0x0000780000000000ULL, 0x0000700000000000ULL, 0x0000600000000000ULL,
+        0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL,
+        0x0080000000000000ULL,
+    },
+    {
+        0x0000010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020408102000ULL, 0x0000000000000000ULL, 0x0000010101010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020408100000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010101000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020408000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020400000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010000000000ULL,
+        0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL,
+        0x0006000000000000ULL, 0x000E000000000000ULL, 0x001E000000000000ULL,
+        0x003E000000000000ULL, 0x007E000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000020202020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040810204000ULL, 0x0000000000000000ULL,
+        0x0000020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040810200000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020202000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000040810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000020200000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004000000000000ULL, 0x000C000000000000ULL, 0x001C000000000000ULL,
+        0x003C000000000000ULL, 0x007C000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040404040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000040404040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000081020400000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000040404000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000081020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000040400000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000081000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL,
+        0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL,
+        0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008000000000000ULL, 0x0018000000000000ULL,
+        0x0038000000000000ULL, 0x0078000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080808080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000080808080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080808000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000102040000000ULL,
+        0x0000040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000080800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000102000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000080000000000ULL,
+        0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0006000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL,
+        0x0030000000000000ULL, 0x0070000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000101010000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000101000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000204000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL,
+        0x0000100000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000E000000000000ULL, 0x000C000000000000ULL, 0x0008000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020000000000000ULL, 0x0060000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000202020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000202020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000202000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000100000000000ULL,
+        0x0000000000000000ULL, 0x0000200000000000ULL, 0x0000000000000000ULL,
+        0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x001E000000000000ULL, 0x001C000000000000ULL, 0x0018000000000000ULL,
+        0x0010000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000201008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404040404000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000404040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000404040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000201000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000404000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000200000000000ULL, 0x0000000000000000ULL, 0x0000400000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x003E000000000000ULL, 0x003C000000000000ULL, 0x0038000000000000ULL,
+        0x0030000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000402010080400ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808080808000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010080000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000808080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402010000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000808080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000402000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000808000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL,
+        0x0000800000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x007E000000000000ULL, 0x007C000000000000ULL, 0x0078000000000000ULL,
+        0x0070000000000000ULL, 0x0060000000000000ULL, 0x0040000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0001010101010100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002040810204000ULL, 0x0001010101010000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040810200000ULL,
+        0x0000000000000000ULL, 0x0001010101000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002040810000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001010100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002040800000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001010000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002040000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001000000000000ULL, 0x0000000000000000ULL,
+        0x0002000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0200000000000000ULL, 0x0600000000000000ULL,
+        0x0E00000000000000ULL, 0x1E00000000000000ULL, 0x3E00000000000000ULL,
+        0x7E00000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0002020202020200ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020202020000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004081020400000ULL, 0x0000000000000000ULL, 0x0002020202000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004081020000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002020200000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004081000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0002020000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0002000000000000ULL,
+        0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0400000000000000ULL,
+        0x0C00000000000000ULL, 0x1C00000000000000ULL, 0x3C00000000000000ULL,
+        0x7C00000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040404040400ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040404040000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0004040404000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008102040000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004040400000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008102000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0004040000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008100000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+        0x0004000000000000ULL, 0x0000000000000000ULL, 0x0008000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0200000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0800000000000000ULL, 0x1800000000000000ULL, 0x3800000000000000ULL,
+        0x7800000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008080808080800ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080808080000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0008080808000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008080800000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010204000000000ULL, 0x0004020000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0008080000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010200000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL,
+        0x0000000000000000ULL, 0x0008000000000000ULL, 0x0000000000000000ULL,
+        0x0010000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0600000000000000ULL,
+        0x0400000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1000000000000000ULL, 0x3000000000000000ULL,
+        0x7000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010101010101000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010101010100000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010101010000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008040200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010101000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0010100000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0008000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL,
+        0x0000000000000000ULL, 0x0020000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0E00000000000000ULL,
+        0x0C00000000000000ULL, 0x0800000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000000000ULL,
+        0x6000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020202020202000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020202020200000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080402000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0020202020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080400000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020202000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010080000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0020200000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0010000000000000ULL, 0x0000000000000000ULL,
+        0x0020000000000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1E00000000000000ULL,
+        0x1C00000000000000ULL, 0x1800000000000000ULL, 0x1000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040404040404000ULL, 0x0000000000000000ULL, 0x0020100804020000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040404040400000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100804000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0040404040000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100800000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040404000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020100000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0040400000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL,
+        0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x3E00000000000000ULL,
+        0x3C00000000000000ULL, 0x3800000000000000ULL, 0x3000000000000000ULL,
+        0x2000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0040201008040200ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080808080808000ULL, 0x0000000000000000ULL,
+        0x0040201008040000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080808080800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201008000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080808080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040201000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080808000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040200000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0080800000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0040000000000000ULL, 0x0000000000000000ULL, 0x0080000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x7E00000000000000ULL,
+        0x7C00000000000000ULL, 0x7800000000000000ULL, 0x7000000000000000ULL,
+        0x6000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+};
+
+const uint64_t line_squares[64][64] =
+{
+    {
+        0x0000000000000000ULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0101010101010101ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL,
+    },
+    {
+        0x00000000000000FFULL, 0x0000000000000000ULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000102ULL,
+        0x0202020202020202ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000010204ULL, 0x0404040404040404ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000010204ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x0000000000000000ULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000001020408ULL, 0x0808080808080808ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001020408ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x0000000000000000ULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x1010101010101010ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000102040810ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x2020202020202020ULL, 0x0000000000804020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x0000000000000000ULL, 0x00000000000000FFULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x4040404040404040ULL,
+        0x0000000000008040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x00000000000000FFULL, 0x00000000000000FFULL,
+        0x00000000000000FFULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL,
+    },
+    {
+        0x0101010101010101ULL, 0x0000000000000102ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0101010101010101ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x8040201008040201ULL, 0x0202020202020202ULL, 0x0000000000010204ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x0000000000000000ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000010204ULL, 0x0202020202020202ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0404040404040404ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000001020408ULL,
+        0x0404040404040404ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0808080808080808ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x0000000000000000ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000102040810ULL, 0x0808080808080808ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x1010101010101010ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x0000000000000000ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x1010101010101010ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x2020202020202020ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x2020202020202020ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+        0x4040404040404040ULL, 0x0102040810204080ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x0000000000000000ULL,
+        0x000000000000FF00ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x4040404040404040ULL, 0x0000000000804020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000008040ULL, 0x8080808080808080ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x000000000000FF00ULL, 0x000000000000FF00ULL, 0x000000000000FF00ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL,
+    },
+    {
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000010204ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000010204ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0101010101010101ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0202020202020202ULL, 0x0000000001020408ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000000000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000001020408ULL, 0x0202020202020202ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0404040404040404ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0404040404040404ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0808080808080808ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000000000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0808080808080808ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x1010101010101010ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000000000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x1010101010101010ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x2020202020202020ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x2020202020202020ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x4040404040404040ULL,
+        0x0204081020408000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000000000ULL, 0x0000000000FF0000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x4040404040404040ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000804020ULL,
+        0x8080808080808080ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000FF0000ULL,
+        0x0000000000FF0000ULL, 0x0000000000FF0000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL,
+    },
+    {
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000001020408ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000001020408ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000001020408ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0101010101010101ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0202020202020202ULL,
+        0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x0000000000000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000102040810ULL,
+        0x0202020202020202ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0404040404040404ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0404040404040404ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0808080808080808ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x0000000000000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0808080808080808ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x1010101010101010ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x0000000000000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x1010101010101010ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x2020202020202020ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x2020202020202020ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x4040404040404040ULL, 0x0408102040800000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x0000000000000000ULL, 0x00000000FF000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x4040404040404040ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000080402010ULL, 0x8080808080808080ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x00000000FF000000ULL, 0x00000000FF000000ULL,
+        0x00000000FF000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0810204080000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL,
+    },
+    {
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000102040810ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000102040810ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000102040810ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0101010101010101ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0202020202020202ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x0000000000000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000010204081020ULL, 0x0202020202020202ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0404040404040404ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0404040404040404ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0808080808080808ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x0000000000000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0808080808080808ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x1010101010101010ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x0000000000000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x1010101010101010ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x2020202020202020ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x2020202020202020ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x4040404040404040ULL, 0x0810204080000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x0000000000000000ULL,
+        0x000000FF00000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0810204080000000ULL, 0x4040404040404040ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000008040201008ULL, 0x8080808080808080ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x000000FF00000000ULL, 0x000000FF00000000ULL, 0x000000FF00000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1020408000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1020408000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL,
+    },
+    {
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000010204081020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000010204081020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000010204081020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0101010101010101ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0202020202020202ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000000000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0001020408102040ULL, 0x0202020202020202ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0404040404040404ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0404040404040404ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0808080808080808ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000000000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0808080808080808ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x1010101010101010ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000000000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x1010101010101010ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x2020202020202020ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x2020202020202020ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x4040404040404040ULL,
+        0x1020408000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000000000000000ULL, 0x0000FF0000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1020408000000000ULL,
+        0x4040404040404040ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000804020100804ULL,
+        0x8080808080808080ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000FF0000000000ULL,
+        0x0000FF0000000000ULL, 0x0000FF0000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2040800000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2040800000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL,
+    },
+    {
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0001020408102040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0001020408102040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0001020408102040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0101010101010101ULL,
+        0x0201000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0402010000000000ULL, 0x0202020202020202ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x0000000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0102040810204080ULL,
+        0x0202020202020202ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0404040404040404ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0404040404040404ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0808080808080808ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x0000000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0808080808080808ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x1010101010101010ULL,
+        0x0810204080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x0000000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x1010101010101010ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x2020202020202020ULL, 0x1020408000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x2020202020202020ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL,
+    },
+    {
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x4040404040404040ULL, 0x2040800000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x0000000000000000ULL, 0x00FF000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2040800000000000ULL, 0x4040404040404040ULL,
+        0x8040201008040201ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0080402010080402ULL, 0x8080808080808080ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x00FF000000000000ULL, 0x00FF000000000000ULL,
+        0x00FF000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4080000000000000ULL,
+        0x8080808080808080ULL,
+    },
+    {
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0101010101010101ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0102040810204080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0101010101010101ULL, 0x0000000000000000ULL,
+        0x0102040810204080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0101010101010101ULL, 0x0102040810204080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0202020202020202ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0202020202020202ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0204081020408000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0202020202020202ULL,
+        0x0000000000000000ULL, 0x0204081020408000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0201000000000000ULL, 0x0202020202020202ULL, 0x0204081020408000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0x0000000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0404040404040404ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0404040404040404ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0408102040800000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0402010000000000ULL, 0x0000000000000000ULL,
+        0x0404040404040404ULL, 0x0000000000000000ULL, 0x0408102040800000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0402010000000000ULL, 0x0404040404040404ULL,
+        0x0408102040800000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0808080808080808ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0810204080000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0808080808080808ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0810204080000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0000000000000000ULL, 0x0808080808080808ULL, 0x0000000000000000ULL,
+        0x0810204080000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0804020100000000ULL,
+        0x0808080808080808ULL, 0x0810204080000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0x0000000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x1010101010101010ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1010101010101010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1020408000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x0000000000000000ULL, 0x1010101010101010ULL,
+        0x0000000000000000ULL, 0x1020408000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x1008040201000000ULL, 0x1010101010101010ULL, 0x1020408000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0x0000000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x2020202020202020ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2020202020202020ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x0000000000000000ULL,
+        0x2020202020202020ULL, 0x0000000000000000ULL, 0x2040800000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x2010080402010000ULL, 0x2020202020202020ULL,
+        0x2040800000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0x0000000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL,
+    },
+    {
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x4040404040404040ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4040404040404040ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x0000000000000000ULL, 0x4040404040404040ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x4020100804020100ULL,
+        0x4040404040404040ULL, 0x4080000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0x0000000000000000ULL,
+        0xFF00000000000000ULL,
+    },
+    {
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x8080808080808080ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8080808080808080ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x0000000000000000ULL, 0x8080808080808080ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+        0x8040201008040201ULL, 0x8080808080808080ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0xFF00000000000000ULL, 0xFF00000000000000ULL, 0xFF00000000000000ULL,
+        0x0000000000000000ULL,
+    },
+};
+
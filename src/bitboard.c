@@ -0,0 +1,157 @@
+#include <stdint.h>
+#include "bitboard.h"
+
+Magic rook_magics[64];
+Magic bishop_magics[64];
+
+/* Every square's attack sets share one table per piece, 102400 entries for
+ * rooks and 5248 for bishops
+ */
+static uint64_t rook_table[0x19000];
+static uint64_t bishop_table[0x1480];
+
+/* Shifts every square of bb by offset, where offset is one of the
+ * directions used in board.c (-8 is up a rank, +1 is right a file)
+ */
+static uint64_t shift(uint64_t bb, int offset)
+{
+    return (offset > 0) ? bb << offset : bb >> -offset;
+}
+
+/* Returns the squares a piece can land on after moving in the direction of
+ * offset without wrapping around the side of the board
+ */
+static uint64_t wrap_mask(int offset)
+{
+    if (offset == 1 || offset == 9 || offset == -7)
+        return ~FILE_A;
+    if (offset == -1 || offset == -9 || offset == 7)
+        return ~FILE_H;
+    return ~0ULL;
+}
+
+/* Returns the squares attacked by sliding from the pieces in gen in the
+ * direction of offset. Every ray stops at, and includes, the first occupied
+ * square it reaches.
+ */
+static uint64_t slide(uint64_t gen, uint64_t occupied, int offset)
+{
+    uint64_t wrap = wrap_mask(offset);
+    uint64_t pro = ~occupied & wrap;
+    gen |= pro & shift(gen, offset);
+    pro &= shift(pro, offset);
+    gen |= pro & shift(gen, 2 * offset);
+    pro &= shift(pro, 2 * offset);
+    gen |= pro & shift(gen, 4 * offset);
+    return shift(gen, offset) & wrap;
+}
+
+/* Fill based slider attacks, only used to build the lookup tables */
+static uint64_t slow_rook_attacks(int square, uint64_t occupied)
+{
+    uint64_t bb = SQUARE_BB(square);
+    return slide(bb, occupied, -8) | slide(bb, occupied, 8)
+         | slide(bb, occupied, -1) | slide(bb, occupied, 1);
+}
+
+static uint64_t slow_bishop_attacks(int square, uint64_t occupied)
+{
+    uint64_t bb = SQUARE_BB(square);
+    return slide(bb, occupied, -9) | slide(bb, occupied, -7)
+         | slide(bb, occupied, 7)  | slide(bb, occupied, 9);
+}
+
+/* Magic multipliers for each square, found offline with a sparse random
+ * search. They are unused when the tables are indexed with PEXT.
+ */
+static const uint64_t rook_magic_numbers[64] =
+{
+    0x0480046281400010ULL, 0x1040100040002002ULL, 0x8780200008300180ULL,
+    0x8880060800100080ULL, 0x8200020104100820ULL, 0x0200100104020008ULL,
+    0x0480010000800200ULL, 0x4E00008201005024ULL, 0x1000800080400020ULL,
+    0x0080401000402001ULL, 0x0104802002801000ULL, 0x4401808010003800ULL,
+    0x8001801801140080ULL, 0x0002000810020004ULL, 0x0002004402004108ULL,
+    0x0011800300004180ULL, 0x4540008020408006ULL, 0x0000404000201001ULL,
+    0x7D10010100200040ULL, 0x1380808008001002ULL, 0x4408010005000810ULL,
+    0x0012008080020400ULL, 0x0002040002081001ULL, 0x102202000444810CULL,
+    0x0100400080208001ULL, 0x4800400140201002ULL, 0x1060100080200082ULL,
+    0x00E0100080080084ULL, 0x0001000500080010ULL, 0x4002000600100419ULL,
+    0x0000020400104108ULL, 0x4805800080004100ULL, 0x0280002001400240ULL,
+    0xA010002000400040ULL, 0x0430124103002000ULL, 0x02820A0042002010ULL,
+    0x0131001005000800ULL, 0x0C01000401000208ULL, 0x8102010204001008ULL,
+    0x0802004092001104ULL, 0x4C40004020808002ULL, 0x4410500420024000ULL,
+    0x00C0100020008080ULL, 0x0000100008008080ULL, 0x0004008008008004ULL,
+    0x0802000804010100ULL, 0x0001011002040008ULL, 0x00330044008A0009ULL,
+    0x1000400280022480ULL, 0x0840004880200880ULL, 0x0000200080100080ULL,
+    0x8044080480100080ULL, 0x0100040080080080ULL, 0x2084010002004040ULL,
+    0x0040020850410400ULL, 0x000900A114084200ULL, 0x00008002204A1101ULL,
+    0x0801004000201081ULL, 0x4300C0200011000DULL, 0x1385002008041001ULL,
+    0x140A0084A0181032ULL, 0x040300040018020DULL, 0x0000280201009004ULL,
+    0x0003000208902041ULL
+};
+
+static const uint64_t bishop_magic_numbers[64] =
+{
+    0x48081010008A2A80ULL, 0x0102C40404821100ULL, 0x0021480880800180ULL,
+    0x0004504201800180ULL, 0x0004042111103108ULL, 0xC242086208200204ULL,
+    0x1000640220900350ULL, 0x10008020901008C4ULL, 0x0000312208080880ULL,
+    0x0220021002009900ULL, 0x0802120C24082080ULL, 0x0044110404810900ULL,
+    0x40002848400A0000ULL, 0x2020409004201400ULL, 0x1000020804028830ULL,
+    0x0008002414040491ULL, 0x0008403429080820ULL, 0x0108001090209080ULL,
+    0x6424084043060030ULL, 0x88A8103404208810ULL, 0x0014004210140404ULL,
+    0x800A000101010148ULL, 0x0001004411180200ULL, 0x1000408101080121ULL,
+    0x0008068340104200ULL, 0x0112110008110800ULL, 0x042808200C004110ULL,
+    0x4048080004820002ULL, 0x2001010000104000ULL, 0x000C024008081A00ULL,
+    0x0404040025108214ULL, 0x2000404001010802ULL, 0x0041041381202000ULL,
+    0x01008C1005601680ULL, 0x01D010900002040AULL, 0x4040020080080080ULL,
+    0x00050A0400820102ULL, 0x8018820080041000ULL, 0xC2014101200A0802ULL,
+    0x0108061042308052ULL, 0x8004020242201020ULL, 0x08A1008884122030ULL,
+    0x0202010028020480ULL, 0x5080008401001020ULL, 0x8820204410400400ULL,
+    0x0020020041100200ULL, 0x0844504200400201ULL, 0x1882480200800020ULL,
+    0xC002080404040400ULL, 0x0382004108292000ULL, 0xA005020442088020ULL,
+    0x2000042820880310ULL, 0x0803008821011400ULL, 0x4086080218420420ULL,
+    0x00B0200282860400ULL, 0x1088880100420028ULL, 0x1030820110010500ULL,
+    0x0080012608025800ULL, 0x0002810084008800ULL, 0x8009001800420200ULL,
+    0x000B000010021202ULL, 0x433080C0104C0120ULL, 0x0002906048112040ULL,
+    0x40106000A1160020ULL
+};
+
+/* Fills in the Magic for every square of one piece type and stores the
+ * attacks for each subset of the relevant occupancy in table.
+ */
+static void init_magics(Magic* magics, const uint64_t* magic_numbers,
+        uint64_t* table, uint64_t (*attacks)(int, uint64_t))
+{
+    int square;
+    uint64_t* next = table;
+    for (square = 0; square < 64; ++square)
+    {
+        Magic* m = &magics[square];
+        uint64_t edges = ((RANK_8 | RANK_1) & ~(RANK_8 << (square / 8 * 8)))
+                       | ((FILE_A | FILE_H) & ~(FILE_A << (square % 8)));
+        m->mask = attacks(square, 0) & ~edges;
+        m->magic = magic_numbers[square];
+        m->shift = 64 - __builtin_popcountll(m->mask);
+        m->attacks = next;
+
+        /* Enumerate every subset of the mask with the Carry-Rippler trick */
+        uint64_t b = 0;
+        do
+        {
+            m->attacks[magic_index(m, b)] = attacks(square, b);
+            b = (b - m->mask) & m->mask;
+        } while (b);
+        next += 1ULL << __builtin_popcountll(m->mask);
+    }
+}
+
+/* Builds the sliding piece attack tables. Must be called once at startup
+ * before any slider attack lookups are made.
+ */
+void init_bitboards()
+{
+    init_magics(rook_magics, rook_magic_numbers, rook_table,
+            slow_rook_attacks);
+    init_magics(bishop_magics, bishop_magic_numbers, bishop_table,
+            slow_bishop_attacks);
+}
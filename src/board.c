@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include "board.h"
+#include "bitboard.h"
+#include "scan.h"
 
 #ifdef DEBUG
 #define print_debug(...) fprintf(stderr,__VA_ARGS__)
@@ -13,6 +15,18 @@ int is_attacked(Board* board, int square);
 int castle(Board* board, int side);
 void check_king(Board* board, int square, uint8_t piece, Found* founds);
 
+/* Random keys xored together to make Board.hash. Pieces are indexed by
+ * color * 6 + TYPE_INDEX and en passant by file.
+ */
+static uint64_t zobrist_pieces[12][64];
+static uint64_t zobrist_castling[16];
+static uint64_t zobrist_en_p[8];
+static uint64_t zobrist_black;
+
+/* Recently built attack maps, see get_attack_map() */
+#define ATTACK_MAPS 64
+static __thread AttackMap attack_maps[ATTACK_MAPS];
+
 const Move default_move = 
 {
     .dest = -1,
@@ -26,78 +40,105 @@ const Move default_move =
     .promotion = QUEEN
 };
 
+/* Values of the pieces by TYPE_INDEX */
+static const int piece_values[6] = {1, 3, 3, 5, 9, 10};
+
+/* Gets value of a piece such as ROOK, or 0 for an empty square */
+int get_piece_value(uint8_t piece)
+{
+    if (!(piece & ALL_PIECES))
+        return 0;
+    return piece_values[TYPE_INDEX(piece)];
+}
+
 /* Gets value of piece on passed square */
 int get_value(Board* board, int square)
 {
-    uint8_t piece;
     if (square < 64 && square >= 0)
-        piece = board->position[square];
-    else
-        return 0;
-    if (piece & PAWN)
-        return 1; 
-    else if (piece & BISHOP || piece & KNIGHT)
-        return 3;
-    else if (piece & ROOK)
-        return 5;
-    else if (piece & QUEEN)
-        return 9;
-    else if (piece & KING)
-        return 10;
-    else
-        return 0;
+        return get_piece_value(board->position[square]);
+    return 0;
 }
 
 /* Populates white_score and black_score with the material score of the board
  */
 void get_material_scores(Board* board, int* white_score, int* black_score)
+{
+    white_score[0] = board->material[0]; /* First element is score counter */
+    /* All other elements count the pieces missing of that type */
+    white_score[1] = 8 - PIECE_COUNT(board, PAWN   | WHITE);
+    white_score[2] = 2 - PIECE_COUNT(board, BISHOP | WHITE);
+    white_score[3] = 2 - PIECE_COUNT(board, KNIGHT | WHITE);
+    white_score[4] = 2 - PIECE_COUNT(board, ROOK   | WHITE);
+    white_score[5] = 1 - PIECE_COUNT(board, QUEEN  | WHITE);
+    black_score[0] = board->material[1];
+    black_score[1] = 8 - PIECE_COUNT(board, PAWN   | BLACK);
+    black_score[2] = 2 - PIECE_COUNT(board, BISHOP | BLACK);
+    black_score[3] = 2 - PIECE_COUNT(board, KNIGHT | BLACK);
+    black_score[4] = 2 - PIECE_COUNT(board, ROOK   | BLACK);
+    black_score[5] = 1 - PIECE_COUNT(board, QUEEN  | BLACK);
+}
+
+/* Returns non-zero if neither side has a pawn, rook or queen, or more than
+ * one bishop or knight, to mate with
+ */
+int insufficient_material(Board* board)
 {
     int i;
-    white_score[0] = 0; /* First element is score counter */ 
-    white_score[1] = 8; /* All other elements are counters for that piece */ 
-    white_score[2] = 2;
-    white_score[3] = 2;
-    white_score[4] = 2;
-    white_score[5] = 1;
-    black_score[0] = 0;
-    black_score[1] = 8;
-    black_score[2] = 2;
-    black_score[3] = 2;
-    black_score[4] = 2;
-    black_score[5] = 1;
-    for (i = 0; i < 64; ++i)
+    for (i = 0; i < 2; ++i)
     {
-        if (board->position[i] & 0x80)
-        {
-            black_score[0] += get_value(board, i);
-            if (board->position[i] & PAWN)
-                black_score[1]--;
-            if (board->position[i] & BISHOP)
-                black_score[2]--;
-            if (board->position[i] & KNIGHT)
-                black_score[3]--;
-            if (board->position[i] & ROOK)
-                black_score[4]--;
-            if (board->position[i] & QUEEN)
-                black_score[5]--;
-        }
-        else
+        uint8_t color = (i) ? BLACK : WHITE;
+        if (PIECE_COUNT(board, PAWN | color) || PIECE_COUNT(board, ROOK | color)
+                || PIECE_COUNT(board, QUEEN | color))
+            return 0;
+        if (PIECE_COUNT(board, BISHOP | color)
+                + PIECE_COUNT(board, KNIGHT | color) > 1)
+            return 0;
+    }
+    return 1;
+}
+
+/* Fills the Zobrist key tables. The generator has a fixed seed so keys are
+ * the same from run to run. Must be called once at startup.
+ */
+void init_zobrist()
+{
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    uint64_t* keys[] = {zobrist_pieces[0], zobrist_castling, zobrist_en_p,
+        &zobrist_black};
+    int counts[] = {12 * 64, 16, 8, 1};
+    int i;
+    int j;
+    for (i = 0; i < 4; ++i)
+    {
+        for (j = 0; j < counts[i]; ++j)
         {
-            white_score[0] += get_value(board, i);
-            if (board->position[i] & PAWN)
-                white_score[1]--;
-            if (board->position[i] & BISHOP)
-                white_score[2]--;
-            if (board->position[i] & KNIGHT)
-                white_score[3]--;
-            if (board->position[i] & ROOK)
-                white_score[4]--;
-            if (board->position[i] & QUEEN)
-                white_score[5]--;
+            /* xorshift64* */
+            seed ^= seed >> 12;
+            seed ^= seed << 25;
+            seed ^= seed >> 27;
+            keys[i][j] = seed * 0x2545F4914F6CDD1DULL;
         }
     }
 }
 
+/* Computes the Zobrist key of the position from scratch */
+uint64_t position_key(Board* board)
+{
+    uint64_t key = zobrist_castling[board->castling & 0x0F];
+    int i;
+    for (i = 0; i < 64; ++i)
+    {
+        uint8_t piece = board->position[i];
+        if (piece & ALL_PIECES)
+            key ^= zobrist_pieces[COLOR_INDEX(piece) * 6 + TYPE_INDEX(piece)][i];
+    }
+    if (board->en_p != -1)
+        key ^= zobrist_en_p[board->en_p % 8];
+    if (board->to_move)
+        key ^= zobrist_black;
+    return key;
+}
+
 /* Sets board state to all default values */
 void empty_board(Board* board)
 {
@@ -108,25 +149,74 @@ void empty_board(Board* board)
     board->moves = 1;
     board->bking_pos = 0;
     board->wking_pos = 0;
-    board->pos_count = 0;
-    board->white_name[0] = '\0';
-    board->black_name[0] = '\0';
     int i;
     for (i = 0; i < 64; ++i)
         board->position[i] = 0;
-    board->history_count = 0;
-    for (i = 0; i < MAX_HISTORY; ++i)
+    memset(board->pieces, 0, sizeof(board->pieces));
+    memset(board->occupied, 0, sizeof(board->occupied));
+    board->material_key = 0;
+    board->material[0] = 0;
+    board->material[1] = 0;
+    board->hash = position_key(board);
+}
+
+/* Empties the board and starts a game with no names or history. The history
+ * of a game being reused must be released with free_game() first.
+ */
+void empty_game(Game* game)
+{
+    empty_board(&game->board);
+    game->white_name[0] = '\0';
+    game->black_name[0] = '\0';
+    game->history_count = 0;
+    game->history_size = 0;
+    game->history = NULL;
+    game->keys = NULL;
+}
+
+/* Releases the history of a game. The board itself is left as it is. */
+void free_game(Game* game)
+{
+    free(game->history);
+    free(game->keys);
+    game->history_count = 0;
+    game->history_size = 0;
+    game->history = NULL;
+    game->keys = NULL;
+}
+
+/* Returns a cleared record for the next move of the game, doubling the room
+ * in the history whenever it fills up
+ */
+static Move* next_record(Game* game)
+{
+    if (game->history_count == game->history_size)
     {
-        board->history[i].dest = -1;
-        board->history[i].src_piece = -1;
-        board->history[i].src_rank = -1;
-        board->history[i].src_file = -1;
-        board->history[i].piece_taken = 0;
-        board->history[i].gave_check = 0;
-        board->history[i].castle = -1;
-        board->history[i].game_over = 0;
-        board->history[i].promotion = 0;
+        int size = (game->history_size) ? game->history_size * 2 : 128;
+        Move* history = realloc(game->history, size * sizeof(Move));
+        if (history)
+            game->history = history;
+        uint64_t* keys = realloc(game->keys, size * sizeof(uint64_t));
+        if (keys)
+            game->keys = keys;
+        if (!history || !keys)
+        {
+            perror("Couldn't grow game history");
+            exit(1);
+        }
+        game->history_size = size;
     }
+    Move* record = &game->history[game->history_count];
+    record->dest = -1;
+    record->src_piece = -1;
+    record->src_rank = -1;
+    record->src_file = -1;
+    record->piece_taken = 0;
+    record->gave_check = 0;
+    record->castle = -1;
+    record->game_over = 0;
+    record->promotion = 0;
+    return record;
 }
 
 /* Sets board to default chess starting position */
@@ -137,32 +227,70 @@ void default_board(Board* board)
     board->bking_pos = 4;
     board->wking_pos = 60;
     board->castling = 0x0F;
-    memcpy(board->white_name, "White\0", 6);
-    memcpy(board->black_name, "Black\0", 6);
-    board->position[0] = ROOK   | BLACK;
-    board->position[1] = KNIGHT | BLACK;
-    board->position[2] = BISHOP | BLACK;
-    board->position[3] = QUEEN  | BLACK;
-    board->position[4] = KING   | BLACK;
-    board->position[5] = BISHOP | BLACK;
-    board->position[6] = KNIGHT | BLACK;
-    board->position[7] = ROOK   | BLACK;
+    board->hash ^= zobrist_castling[0] ^ zobrist_castling[0x0F];
+    set_square(board, 0, ROOK   | BLACK);
+    set_square(board, 1, KNIGHT | BLACK);
+    set_square(board, 2, BISHOP | BLACK);
+    set_square(board, 3, QUEEN  | BLACK);
+    set_square(board, 4, KING   | BLACK);
+    set_square(board, 5, BISHOP | BLACK);
+    set_square(board, 6, KNIGHT | BLACK);
+    set_square(board, 7, ROOK   | BLACK);
     for (i = 0; i < 8; ++i)
     {
-        board->position[i + 8]     = PAWN | BLACK;
-        board->position[i + 8 * 6] = PAWN | WHITE;
+        set_square(board, i + 8,     PAWN | BLACK);
+        set_square(board, i + 8 * 6, PAWN | WHITE);
     }
-    board->position[0 + 8 * 7] = ROOK   | WHITE;
-    board->position[1 + 8 * 7] = KNIGHT | WHITE;
-    board->position[2 + 8 * 7] = BISHOP | WHITE;
-    board->position[3 + 8 * 7] = QUEEN  | WHITE;
-    board->position[4 + 8 * 7] = KING   | WHITE;
-    board->position[5 + 8 * 7] = BISHOP | WHITE;
-    board->position[6 + 8 * 7] = KNIGHT | WHITE;
-    board->position[7 + 8 * 7] = ROOK   | WHITE;
+    set_square(board, 0 + 8 * 7, ROOK   | WHITE);
+    set_square(board, 1 + 8 * 7, KNIGHT | WHITE);
+    set_square(board, 2 + 8 * 7, BISHOP | WHITE);
+    set_square(board, 3 + 8 * 7, QUEEN  | WHITE);
+    set_square(board, 4 + 8 * 7, KING   | WHITE);
+    set_square(board, 5 + 8 * 7, BISHOP | WHITE);
+    set_square(board, 6 + 8 * 7, KNIGHT | WHITE);
+    set_square(board, 7 + 8 * 7, ROOK   | WHITE);
 }
 
 
+/* Starts a new game from the default position */
+void default_game(Game* game)
+{
+    empty_game(game);
+    default_board(&game->board);
+    memcpy(game->white_name, "White\0", 6);
+    memcpy(game->black_name, "Black\0", 6);
+}
+
+/* Places piece on square, keeping the bitboards in sync with the position
+ * array. A piece of 0 empties the square.
+ */
+void set_square(Board* board, int square, uint8_t piece)
+{
+    uint8_t old = board->position[square];
+    uint64_t bit = SQUARE_BB(square);
+    if (old & ALL_PIECES)
+    {
+        board->pieces[TYPE_INDEX(old)] &= ~bit;
+        board->occupied[COLOR_INDEX(old)] &= ~bit;
+        board->material[COLOR_INDEX(old)] -= piece_values[TYPE_INDEX(old)];
+        board->material_key -=
+            1ULL << (4 * (COLOR_INDEX(old) * 6 + TYPE_INDEX(old)));
+        board->hash ^=
+            zobrist_pieces[COLOR_INDEX(old) * 6 + TYPE_INDEX(old)][square];
+    }
+    if (piece & ALL_PIECES)
+    {
+        board->pieces[TYPE_INDEX(piece)] |= bit;
+        board->occupied[COLOR_INDEX(piece)] |= bit;
+        board->material[COLOR_INDEX(piece)] += piece_values[TYPE_INDEX(piece)];
+        board->material_key +=
+            1ULL << (4 * (COLOR_INDEX(piece) * 6 + TYPE_INDEX(piece)));
+        board->hash ^=
+            zobrist_pieces[COLOR_INDEX(piece) * 6 + TYPE_INDEX(piece)][square];
+    }
+    board->position[square] = piece;
+}
+
 /* Move contents of one square to another */
 void move_square(Board* board, int dest, int src)
 {
@@ -170,8 +298,8 @@ void move_square(Board* board, int dest, int src)
         board->bking_pos = dest;
     if (board->position[src] == (KING | WHITE))
         board->wking_pos = dest;
-    board->position[dest] = board->position[src];
-    board->position[src] = 0;
+    set_square(board, dest, board->position[src]);
+    set_square(board, src, 0);
 }
 
 /* Move contents of one square to another.     */
@@ -196,70 +324,19 @@ enum Direction
     DOWNL =  7
 };
 
-/* Returns zero if moving the contents of src to dest will result in the king
- * being put into check, and non-zero otherwise.
- */
-int is_legal(Board* board, int dest, int src)
+/* Returns the bitboard holding every piece matching piece, e.g. ROOK | BLACK */
+uint64_t piece_bb(Board* board, uint8_t piece)
 {
-    uint8_t color = board->position[src] & 0x80;
-    /* Check if in bounds */
-    if (dest < 0 || dest > 63)
-        return 0;
-    if (board->position[dest] && (board->position[dest] & 0x80) == color)
-        return 0;
-
-    /* Create a deep copy of the board */
-    Board t_board;
-    memcpy(&t_board, board, sizeof(Board));
-
-    /* Make the move on the board copy */
-    move_square(&t_board, dest, src);
-    if (dest == t_board.en_p && (t_board.position[dest] & PAWN))
-    {
-        if (color)
-            t_board.position[dest + UP] = 0;
-        else
-            t_board.position[dest + DOWN] = 0;
-    }
-
-    int square_check;
-    if (board->to_move)
-        square_check = t_board.bking_pos;
-    else
-        square_check = t_board.wking_pos;
-
-    /* Check if that move put the friendly KING in check */
-    if (!is_attacked(&t_board, square_check))
-        return 1;
-    return 0;
+    return board->pieces[TYPE_INDEX(piece)] & board->occupied[COLOR_INDEX(piece)];
 }
 
-/* Places all moves from src that are legal into dest */
-void check_for_check(Board* board, int square,
-        Found* dest, Found* src)
+/* Adds every square in bb to the found struct */
+void add_founds(Found* founds, uint64_t bb)
 {
-    dest->en_p_taken = src->en_p_taken;
-    dest->promotion = src->promotion;
-    dest->made_en_p = src->made_en_p;
-    int i;
-    for (i = 0; i < src->num_found; ++i)
+    while (bb)
     {
-        int csquare = src->squares[i];
-        if (is_legal(board, square, src->squares[i]))
-        {
-            dest->num_found++;
-            dest->squares[dest->num_found - 1] = src->squares[i];
-            if (src->castle != -1 && (csquare == 60 || csquare == 4))
-            {
-                if (castle(board, src->castle))
-                    dest->castle = src->castle;
-                else
-                {
-                    dest->squares[dest->num_found - 1] = -1;
-                    dest->num_found--;
-                }
-            }
-        }
+        founds->num_found++;
+        founds->squares[founds->num_found - 1] = pop_lsb(&bb);
     }
 }
 
@@ -268,62 +345,7 @@ void check_for_check(Board* board, int square,
  */
 void check_knight(Board* board, int square, uint8_t piece, Found* founds)
 {
-    if (square + UP + UPL >= 0 && square + UP + UPL <= 63)
-        if (square / 8 > 1 && square % 8 > 0)
-            if (board->position[square + UP + UPL] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + UP + UPL;
-            }
-    if (square + LEFT + UPL >= 0 && square + LEFT + UPL <= 63)
-        if (square / 8 > 0 && square % 8 > 1)
-            if (board->position[square + LEFT + UPL] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + LEFT + UPL;
-            }
-    if (square + UP + UPR >= 0 && square + UP + UPR <= 63)
-        if (square / 8 > 1 && square % 8 < 7)
-            if (board->position[square + UP + UPR] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + UP + UPR;
-            }
-    if (square + RIGHT + UPR >= 0 && square + RIGHT + UPR <= 63)
-        if (square / 8 > 0 && square % 8 < 6)
-            if (board->position[square + RIGHT + UPR] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + RIGHT + UPR;
-            }
-    if (square + LEFT + DOWNL >= 0 && square + LEFT + DOWNL <= 63)
-        if (square / 8 < 7 && square % 8 > 1)
-            if (board->position[square + LEFT + DOWNL] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + LEFT + DOWNL;
-            }
-    if (square + DOWN + DOWNL >= 0 && square + DOWN + DOWNL <= 63)
-        if (square / 8 < 6 && square % 8 > 0)
-            if (board->position[square + DOWN + DOWNL] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + DOWN + DOWNL;
-            }
-    if (square + RIGHT + DOWNR >= 0 && square + RIGHT + DOWNR <= 63)
-        if (square / 8 < 7 && square % 8 < 6)
-            if (board->position[square + RIGHT + DOWNR] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + RIGHT + DOWNR;
-            }
-    if (square + DOWN + DOWNR >= 0 && square + DOWN + DOWNR <= 63)
-        if (square / 8 < 6 && square % 8 < 7)
-            if (board->position[square + DOWN + DOWNR] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + DOWN + DOWNR;
-            }
+    add_founds(founds, knight_attacks(square) & piece_bb(board, piece));
 }
 
 /* Fills found struct with locations of rooks that can move to square 
@@ -331,78 +353,8 @@ void check_knight(Board* board, int square, uint8_t piece, Found* founds)
  */
 void check_rook(Board* board, int square, uint8_t piece, Found* founds)
 {
-    int i = square;
-    while (i % 8 > 0)
-    {
-        if (i + LEFT >= 0 && i + LEFT <= 63)
-        {
-            i += LEFT;
-            if (board->position[i] != 0 && board->position[i] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = i;
-                break;
-            }
-            else if (board->position[i])
-                break;
-        }
-        else
-            break;
-    }
-    i = square;
-    while (i % 8 < 7)
-    {
-        if (i + RIGHT >= 0 && i + RIGHT <= 63)
-        {
-            i += RIGHT;
-            if (board->position[i] && board->position[i] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = i;
-                break;
-            }
-            else if (board->position[i])
-                break;
-        }
-        else
-            break;
-    }
-    i = square;
-    while (i / 8 > 0)
-    {
-        if (i + UP >= 0 && i + UP <= 63)
-        {
-            i += UP;
-            if (board->position[i] && board->position[i] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = i;
-                break;
-            }
-            else if (board->position[i])
-                break;
-        }
-        else
-            break;
-    }
-    i = square;
-    while (i / 8 < 7)
-    {
-        if (i + DOWN >= 0 && i + DOWN <= 63)
-        {
-            i += DOWN;
-            if (board->position[i] && board->position[i] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = i;
-                break;
-            }
-            else if (board->position[i])
-                break;
-        }
-        else
-            break;
-    }
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    add_founds(founds, rook_attacks(square, occupied) & piece_bb(board, piece));
 }
 
 /* Fills found struct with locations of bishops that can move to square 
@@ -410,296 +362,353 @@ void check_rook(Board* board, int square, uint8_t piece, Found* founds)
  */
 void check_bishop(Board* board, int square, uint8_t piece, Found* founds)
 {
-    int i = square;
-    while ((i + UPL) % 8 < 7 && (i + UPL) / 8 < 7)
-    {
-        if (i + UPL >= 0 && i + UPL <= 63)
-        {
-            i += UPL;
-            if (board->position[i] && board->position[i] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = i;
-            }
-            else if (board->position[i])
-                break;
-        }
-        else
-            break;
-    }
-    i = square;
-    while ((i + UPR) % 8 > 0 && (i + UPR) / 8 < 7)
-    {
-        if (i + UPR >= 0 && i + UPR <= 63)
-        {
-            i += UPR;
-            if (board->position[i] && board->position[i] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = i;
-            }
-            else if (board->position[i])
-                break;
-        }
-        else
-            break;
-    }
-    i = square;
-    while ((i + DOWNL) % 8 < 7 && (i + DOWNL) / 8 > 0)
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    add_founds(founds, bishop_attacks(square, occupied) & piece_bb(board, piece));
+}
+
+/* Fills found struct with locations of pawns that can move to square 
+ * Does not check if the move will result in own KING being put in check
+ */
+void check_pawn(Board* board, int square, uint8_t piece, Found* founds)
+{
+    uint8_t color = piece & 0x80;
+    uint8_t target = board->position[square];
+    uint64_t pawns = piece_bb(board, piece);
+    int forward = (color) ? DOWN : UP;
+    int num_found = founds->num_found;
+
+    /* Pawns of color attack square if a pawn of the other color on square
+     * would attack them
+     */
+    uint64_t attackers = pawn_attacks(square, !color) & pawns;
+    if (target && (target & 0x80) != color)
+        add_founds(founds, attackers);
+    else if (!target && square == board->en_p &&
+            square / 8 == ((color) ? 5 : 2) && attackers)
     {
-        if (i + DOWNL >= 0 && i + DOWNL <= 63)
-        {
-            i += DOWNL;
-            if (board->position[i] && board->position[i] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = i;
-            }
-            else if (board->position[i])
-                break;
-        }
-        else
-            break;
+        add_founds(founds, attackers);
+        founds->en_p_taken = square - forward;
     }
-    i = square;
-    while ((i + DOWNR) % 8 > 0 && (i + DOWNR) / 8 > 0)
+
+    if (!target && square / 8 != ((color) ? 0 : 7))
     {
-        if (i + DOWNR >= 0 && i + DOWNR <= 63)
+        if (pawns & SQUARE_BB(square - forward))
+            add_founds(founds, SQUARE_BB(square - forward));
+        else if (square / 8 == ((color) ? 3 : 4) &&
+                !board->position[square - forward] &&
+                (pawns & SQUARE_BB(square - 2 * forward)))
         {
-            i += DOWNR;
-            if (board->position[i] && board->position[i] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = i;
-            }
-            else if (board->position[i])
-                break;
+            add_founds(founds, SQUARE_BB(square - 2 * forward));
+            founds->made_en_p = square - forward;
         }
-        else
-            break;
     }
+
+    if (founds->num_found > num_found && square / 8 == ((color) ? 7 : 0))
+        founds->promotion = 1;
 }
 
-/* Fills found struct with locations of pawns that can move to square 
- * Does not check if the move will result in own KING being put in check
+/* Returns a bitboard of the pieces of both colors that attack square when the
+ * occupied squares are given by occupied
  */
-void check_pawn(Board* board, int square, uint8_t piece, Found* founds)
+uint64_t attackers_to(Board* board, int square, uint64_t occupied)
+{
+    uint64_t queens = board->pieces[TYPE_INDEX(QUEEN)];
+    uint64_t pawns = board->pieces[TYPE_INDEX(PAWN)];
+    return (pawn_attacks(square, WHITE) & pawns & board->occupied[1])
+         | (pawn_attacks(square, BLACK) & pawns & board->occupied[0])
+         | (knight_attacks(square) & board->pieces[TYPE_INDEX(KNIGHT)])
+         | (king_attacks(square) & board->pieces[TYPE_INDEX(KING)])
+         | (rook_attacks(square, occupied)
+                & (board->pieces[TYPE_INDEX(ROOK)] | queens))
+         | (bishop_attacks(square, occupied)
+                & (board->pieces[TYPE_INDEX(BISHOP)] | queens));
+}
+
+/* returns non-zero if the square can be moved to by an opposite color piece
+ *
+ * Built with USE_SIMD_ATTACKS the rays from square are scanned on the
+ * position array with AVX2 instead of reading the attack map.
+ */
+int is_attacked(Board* board, int square)
+{
+#ifdef USE_SIMD_ATTACKS
+    return ray_attacked(board->position, square, board->to_move == 0);
+#else
+    return (get_attack_map(board)->attacked[!board->to_move]
+            & SQUARE_BB(square)) != 0;
+#endif
+}
+
+/* Returns the squares attacked by piece standing on square */
+uint64_t piece_attacks(uint8_t piece, int square, uint64_t occupied)
 {
-    if (square == board->en_p)
+    if (piece & PAWN)
+        return pawn_attacks(square, piece & 0x80);
+    if (piece & KNIGHT)
+        return knight_attacks(square);
+    if (piece & BISHOP)
+        return bishop_attacks(square, occupied);
+    if (piece & ROOK)
+        return rook_attacks(square, occupied);
+    if (piece & QUEEN)
+        return bishop_attacks(square, occupied) | rook_attacks(square, occupied);
+    if (piece & KING)
+        return king_attacks(square);
+    return 0;
+}
+
+/* Adds one to the attacker count of every square in attacks, counting up
+ * to 15
+ */
+static void add_attacks(uint64_t* counts, uint64_t attacks)
+{
+    int i;
+    for (i = 0; i < 4 && attacks; ++i)
     {
-        if (square / 8 == 2)
-        {
-            if (board->position[square + DOWNL]  == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + DOWNL;
-                founds->en_p_taken = square + DOWN;
-            }
-            if (board->position[square + DOWNR]  == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + DOWNR;
-                founds->en_p_taken = square + DOWN;
-            }
-        }
-        else if (square / 8 == 5)
-        {
-            if (board->position[square + UPR]  == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + UPR;
-                founds->en_p_taken = square + UP;
-            }
-            if (board->position[square + UPL]  == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + UPL;
-                founds->en_p_taken = square + UP;
-            }
-        }
+        uint64_t carry = counts[i] & attacks;
+        counts[i] ^= attacks;
+        attacks = carry;
     }
-    if (square / 8 == 4 && !board->position[square])
+}
+
+/* Adds the attacks of the pieces of color to map. Like generate_side() it
+ * is only called with a constant color, so the pawns of each color are
+ * shifted as a set in their own direction.
+ */
+static inline __attribute__((always_inline))
+void add_side_attacks(Board* board, AttackMap* map, const int color)
+{
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    uint64_t ours = board->occupied[color];
+    uint64_t queens = board->pieces[TYPE_INDEX(QUEEN)];
+    /* Sliders see through the enemy king, which can not step back along
+     * the line it is checked on
+     */
+    uint64_t through_king = occupied & ~(board->pieces[TYPE_INDEX(KING)]
+                                         & board->occupied[!color]);
+    uint64_t pawns = board->pieces[TYPE_INDEX(PAWN)] & ours;
+    uint64_t attacks = pawn_attacks_west(pawns, color);
+    uint64_t danger = attacks;
+    add_attacks(map->counts[color], attacks);
+    attacks = pawn_attacks_east(pawns, color);
+    danger |= attacks;
+    add_attacks(map->counts[color], attacks);
+
+    uint64_t pieces = board->pieces[TYPE_INDEX(KNIGHT)] & ours;
+    while (pieces)
     {
-        uint8_t looking_at = board->position[square + 2 * DOWN];
-        if (!(looking_at & 0x80))
-            if (looking_at == piece && !(board->position[square + DOWN]))
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + 2 * DOWN;
-                founds->made_en_p = square + DOWN;
-            }
+        attacks = knight_attacks(pop_lsb(&pieces));
+        danger |= attacks;
+        add_attacks(map->counts[color], attacks);
     }
-    else if (square / 8 == 3 && !board->position[square])
+    pieces = board->pieces[TYPE_INDEX(KING)] & ours;
+    while (pieces)
     {
-        uint8_t looking_at = board->position[square + 2 * UP];
-        if (looking_at & 0x80)
-            if (looking_at == piece && !(board->position[square + UP]))
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + 2 * UP;
-                founds->made_en_p = square + UP;
-            }
+        attacks = king_attacks(pop_lsb(&pieces));
+        danger |= attacks;
+        add_attacks(map->counts[color], attacks);
     }
-    else 
-        founds->made_en_p = -1;
-
-    if (!(piece & 0x80) && square / 8 == 0)
-        founds->promotion = 1;
-    if ((piece & 0x80) && square / 8 == 7)
-        founds->promotion = 1;
+    map->attacked[color] = danger;
 
-    if (board->to_move)
+    pieces = (board->pieces[TYPE_INDEX(BISHOP)] | queens) & ours;
+    while (pieces)
     {
-        if (board->position[square] && !(board->position[square] & BLACK))
-        {
-            if (square % 8 < 7 && square / 8 > 0)
-                if (board->position[square + UPR] == piece)
-                {
-                    founds->num_found++;
-                    founds->squares[founds->num_found - 1] = square + UPR;
-                }
-            if (square % 8 > 0 && square / 8 > 0)
-                if (board->position[square + UPL] == piece)
-                {
-                    founds->num_found++;
-                    founds->squares[founds->num_found - 1] = square + UPL;
-                }
-        }
-        if (square + UP >= 0)
-           if(board->position[square + UP] == piece && 
-                                             !board->position[square])
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + UP;
-            }
+        int square = pop_lsb(&pieces);
+        attacks = bishop_attacks(square, occupied);
+        map->attacked[color] |= attacks;
+        add_attacks(map->counts[color], attacks);
+        danger |= bishop_attacks(square, through_king);
     }
-    else
+    pieces = (board->pieces[TYPE_INDEX(ROOK)] | queens) & ours;
+    while (pieces)
     {
-        if (board->position[square] && (board->position[square] & BLACK)) 
-        {
-            if (square % 8 > 0 && square / 8 < 7)
-                if (board->position[square + DOWNL] == piece)
-                {
-                    founds->num_found++;
-                    founds->squares[founds->num_found - 1] = square + DOWNL;
-                }
-            if (square % 8 < 7 && square / 8 < 7)
-                if (board->position[square + DOWNR] == piece)
-                {
-                    founds->num_found++;
-                    founds->squares[founds->num_found - 1] = square + DOWNR;
-                }
-        }
-        if (square + DOWN < 64)
-            if(board->position[square + DOWN] == piece && 
-                                                !board->position[square])
-        {
-            founds->num_found++;
-            founds->squares[founds->num_found - 1] = square + DOWN;
-        }
+        int square = pop_lsb(&pieces);
+        attacks = rook_attacks(square, occupied);
+        map->attacked[color] |= attacks;
+        add_attacks(map->counts[color], attacks);
+        danger |= rook_attacks(square, through_king);
+    }
+    map->danger[!color] = danger;
+}
+
+/* Returns the attack map of the position. Maps are built from the piece
+ * bitboards the first time a position is asked about and then kept in a
+ * small per-thread cache indexed by Board.hash, so the many attack questions
+ * asked about one position are answered by table reads.
+ */
+const AttackMap* get_attack_map(Board* board)
+{
+    AttackMap* map = &attack_maps[board->hash & (ATTACK_MAPS - 1)];
+    if (map->key == board->hash)
+        return map;
+    memset(map, 0, sizeof(AttackMap));
+    map->key = board->hash;
+    add_side_attacks(board, map, 0);
+    add_side_attacks(board, map, 1);
+    return map;
+}
+
+/* Returns how many pieces of color, 0 for white and 1 for black, attack
+ * square
+ */
+int count_attackers(Board* board, int square, int color)
+{
+    const AttackMap* map = get_attack_map(board);
+    int count = 0;
+    int i;
+    for (i = 0; i < 4; ++i)
+        count |= ((map->counts[color][i] >> square) & 1) << i;
+    return count;
+}
+
+/* Fills info with the checks and pins against the king of the side to move */
+void get_check_info(Board* board, CheckInfo* info)
+{
+    int us = board->to_move;
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    info->king = (us) ? board->bking_pos : board->wking_pos;
+    info->checkers = attackers_to(board, info->king, occupied)
+                   & board->occupied[!us];
+    info->pinned = 0;
+    info->danger = get_attack_map(board)->danger[us];
+
+    if (!info->checkers)
+        info->check_mask = ~0ULL;
+    else if (info->checkers & (info->checkers - 1))
+        info->check_mask = 0;
+    else
+        info->check_mask = info->checkers
+            | between_squares[info->king][__builtin_ctzll(info->checkers)];
+
+    /* Enemy sliders that would see the king through exactly one of our
+     * pieces pin that piece
+     */
+    uint64_t queens = board->pieces[TYPE_INDEX(QUEEN)];
+    uint64_t snipers =
+        ((rook_attacks(info->king, 0)
+            & (board->pieces[TYPE_INDEX(ROOK)] | queens))
+       | (bishop_attacks(info->king, 0)
+            & (board->pieces[TYPE_INDEX(BISHOP)] | queens)))
+      & board->occupied[!us];
+    while (snipers)
+    {
+        uint64_t blockers = between_squares[info->king][pop_lsb(&snipers)]
+                          & occupied;
+        if (blockers && !(blockers & (blockers - 1)))
+            info->pinned |= blockers & board->occupied[us];
     }
 }
 
-/* Returns non-zero if any pieces specified can move to square,
- * otherwise it returns zero.
- * Does not check if move will result in check on the king
+/* Returns non-zero if the king of the side to move would be attacked after
+ * the piece on src moves to dest and the piece on captured is removed. The
+ * moving piece may belong to either side.
  */
-int can_move_to(Board* board, int square, uint8_t pieces)
+int king_attacked_after(Board* board, int dest, int src, int captured)
 {
-    Found found_hyp;
-    found_hyp.num_found = 0;
-    found_hyp.en_p_taken = -1;
-    found_hyp.promotion = 0;
-    uint8_t color = (board->to_move) ? BLACK : WHITE;
-    if (pieces & KNIGHT)
-        check_knight(board, square, KNIGHT | color, &found_hyp);
-    if (found_hyp.num_found)
-        return 1;
-    if (pieces & BISHOP)
-        check_bishop(board, square, BISHOP | color, &found_hyp);
-    if (found_hyp.num_found)
-        return 1;
-    if (pieces & ROOK)
-        check_rook(board, square, ROOK | color, &found_hyp);
-    if (found_hyp.num_found)
-        return 1;
-    if (pieces & PAWN)
-        check_pawn(board, square, PAWN | color, &found_hyp);
-    if (found_hyp.num_found)
-        return 1;
-    if (pieces & QUEEN)
-        check_rook(board, square, QUEEN | color, &found_hyp);
-    if (found_hyp.num_found)
-        return 1;
-    if (pieces & QUEEN)
-        check_bishop(board, square, QUEEN | color, &found_hyp);
-    if (found_hyp.num_found)
-        return 1;
-    if (pieces & KING)
-        check_king(board, square, KING | color, &found_hyp);
-    if (found_hyp.num_found)
-        return 1;
-    return 0;
+    uint8_t piece = board->position[src];
+    int us = board->to_move;
+    int king = (us) ? board->bking_pos : board->wking_pos;
+    if (src == king)
+        king = dest;
+    uint64_t removed = SQUARE_BB(src) | SQUARE_BB(dest) | SQUARE_BB(captured);
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    occupied = (occupied & ~SQUARE_BB(src) & ~SQUARE_BB(captured))
+             | SQUARE_BB(dest);
+    uint64_t attackers = attackers_to(board, king, occupied)
+                       & board->occupied[!us] & ~removed;
+    if (COLOR_INDEX(piece) != us)
+        attackers |= piece_attacks(piece, dest, occupied) & SQUARE_BB(king);
+    return attackers != 0;
 }
 
-/* returns non-zero if the square can be moved to by an opposite color piece */
-int is_attacked(Board* board, int square)
+/* Same as is_legal(), but uses the checks and pins already found in info */
+int legal_with_info(Board* board, CheckInfo* info, int dest, int src)
 {
-    board->to_move = !board->to_move;
-    uint8_t color = (board->to_move) ? BLACK : WHITE;
-    uint8_t prev_piece = board->position[square];
-    board->position[square] = PAWN | (color ^ 0x80);
-    int check = can_move_to(board, square, ALL_PIECES);
-    board->position[square] = prev_piece;
-    board->to_move = !board->to_move;
-    return check;
+    uint8_t piece = board->position[src];
+    uint8_t color = piece & 0x80;
+    /* Check if in bounds */
+    if (dest < 0 || dest > 63)
+        return 0;
+    if (board->position[dest] && (board->position[dest] & 0x80) == color)
+        return 0;
+
+    /* Only en passant and moves by the other side need to look at what
+     * attacks the king after the move is made
+     */
+    if (COLOR_INDEX(piece) != board->to_move)
+        return !king_attacked_after(board, dest, src, dest);
+    if (src == info->king)
+        return !(info->danger & SQUARE_BB(dest));
+    if ((piece & PAWN) && dest == board->en_p && dest % 8 != src % 8)
+        return !king_attacked_after(board, dest, src,
+                dest + ((color) ? UP : DOWN));
+
+    if (!(info->check_mask & SQUARE_BB(dest)))
+        return 0;
+    if ((info->pinned & SQUARE_BB(src)) &&
+            !(line_squares[info->king][src] & SQUARE_BB(dest)))
+        return 0;
+    return 1;
 }
 
-/* Returns non-zero if castling is possible
- * Does check if move will result in check on the king
+/* Returns zero if moving the contents of src to dest will result in the king
+ * being put into check, and non-zero otherwise.
  */
-int castle(Board* board, int side)
+int is_legal(Board* board, int dest, int src)
 {
-    enum {KINGSIDE, QUEENSIDE};
-    if (side == KINGSIDE)
-    {
-        if (!board->to_move && board->castling & 0x08)
-        {
-            if (!(board->position[61] | board->position[62]))
-                if(   !is_attacked(board, 60) 
-                   && !is_attacked(board, 61) 
-                   && !is_attacked(board, 62))
-                    return 1;
-        }
-        else if(board->to_move && board->castling & 0x02)
-        {
-            if (!(board->position[5] | board->position[6]))
-                if(   !is_attacked(board, 4) 
-                   && !is_attacked(board, 5) 
-                   && !is_attacked(board, 6))
-                    return 1;
-        }
-    }
-    else if (side == QUEENSIDE)
+    CheckInfo info;
+    get_check_info(board, &info);
+    return legal_with_info(board, &info, dest, src);
+}
+
+/* Places all moves from src that are legal into dest */
+void check_for_check(Board* board, int square, CheckInfo* info,
+        Found* dest, Found* src)
+{
+    dest->en_p_taken = src->en_p_taken;
+    dest->promotion = src->promotion;
+    dest->made_en_p = src->made_en_p;
+    int i;
+    for (i = 0; i < src->num_found; ++i)
     {
-        if (!board->to_move && board->castling & 0x04)
-        {
-            if (!(board->position[57]|board->position[58]|board->position[59]))
-                if(   !is_attacked(board, 60) 
-                   && !is_attacked(board, 59) 
-                   && !is_attacked(board, 58))
-                    return 1;
-        }
-        else if(board->to_move && board->castling & 0x01)
+        int csquare = src->squares[i];
+        if (legal_with_info(board, info, square, src->squares[i]))
         {
-            if (!(board->position[1]|board->position[2]|board->position[3]))
-                if(   !is_attacked(board, 4) 
-                   && !is_attacked(board, 3) 
-                   && !is_attacked(board, 2))
-                    return 1;
+            dest->num_found++;
+            dest->squares[dest->num_found - 1] = src->squares[i];
+            if (src->castle != -1 && (csquare == 60 || csquare == 4))
+            {
+                if (castle(board, src->castle))
+                    dest->castle = src->castle;
+                else
+                {
+                    dest->squares[dest->num_found - 1] = -1;
+                    dest->num_found--;
+                }
+            }
         }
     }
-    return 0;
+}
+
+/* Returns non-zero if castling is possible
+ * Does check if move will result in check on the king
+ */
+int castle(Board* board, int side)
+{
+    enum {KINGSIDE, QUEENSIDE};
+    int king = (board->to_move) ? 4 : 60;
+    int rook = (side == KINGSIDE) ? king + 3 : king - 4;
+    int dest = (side == KINGSIDE) ? king + 2 : king - 2;
+    uint8_t right = ((side == KINGSIDE) ? 0x08 : 0x04) >> (2 * board->to_move);
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    uint64_t path = between_squares[king][dest] | SQUARE_BB(king)
+                  | SQUARE_BB(dest);
+    if (!(board->castling & right) || (occupied & between_squares[king][rook]))
+        return 0;
+    while (path)
+        if (is_attacked(board, pop_lsb(&path)))
+            return 0;
+    return 1;
 }
 
 /* Fills found struct with locations of kings that can move to square 
@@ -707,58 +716,7 @@ int castle(Board* board, int side)
  */
 void check_king(Board* board, int square, uint8_t piece, Found* founds)
 {
-    if (square + LEFT >= 0 && square % 8 > 0)
-        if (board->position[square + LEFT] == piece)
-        {
-            founds->num_found++;
-            founds->squares[founds->num_found - 1] = square + LEFT;
-        }
-    if (square + RIGHT < 64 && square % 8 < 7)
-        if (board->position[square + RIGHT] == piece)
-        {
-            founds->num_found++;
-            founds->squares[founds->num_found - 1] = square + RIGHT;
-        }
-    if (square + UPL >= 0 && square + UPL < 64)
-        if (square % 8 > 0 && square / 8 > 0)
-            if (board->position[square + UPL] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + UPL;
-            }
-    if (square + DOWNR >= 0 && square + DOWNR < 64)
-        if (square % 8 < 7 && square / 8 < 7)
-            if (board->position[square + DOWNR] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + DOWNR;
-            }
-    if (square + UPR >= 0 && square + UPR < 64)
-        if (square % 8 < 7 && square / 8 > 0)
-            if (board->position[square + UPR] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + UPR;
-            }
-    if (square + DOWNL >= 0 && square + DOWNL < 64)
-        if (square % 8 > 0 && square / 8 < 7)
-            if (board->position[square + DOWNL] == piece)
-            {
-                founds->num_found++;
-                founds->squares[founds->num_found - 1] = square + DOWNL;
-            }
-    if (square + UP >= 0 && square / 8 > 0)
-        if (board->position[square + UP] == piece)
-        {
-            founds->num_found++;
-            founds->squares[founds->num_found - 1] = square + UP;
-        }
-    if (square + DOWN < 64 && square / 8 < 7)
-        if (board->position[square + DOWN] == piece)
-        {
-            founds->num_found++;
-            founds->squares[founds->num_found - 1] = square + DOWN;
-        }
+    add_founds(founds, king_attacks(square) & piece_bb(board, piece));
     if ((!board->to_move && square == 62 && board->wking_pos == 60 && (board->castling & 0x8)) ||
          (board->to_move && square == 6 && board->bking_pos == 4 && (board->castling & 0x2)))
     {
@@ -810,6 +768,7 @@ void find_attacker(Board* board, int square, uint8_t piece, Found* founds)
     if (piece & PAWN)
         check_pawn(board, square, PAWN|color, &src);
     print_debug("Num found before check_for_check: %d\n", src.num_found);
+    CheckInfo info;
     int i;
     for (i = 0; i < src.num_found; ++i)
     {
@@ -817,336 +776,507 @@ void find_attacker(Board* board, int square, uint8_t piece, Found* founds)
                 src.squares[i]%8+'a',8-src.squares[i]/8);
     }
     if (src.num_found)
-        check_for_check(board, square, founds, &src);
+    {
+        get_check_info(board, &info);
+        check_for_check(board, square, &info, founds, &src);
+    }
 }
 
-/* Returns 2 if the current position is stalemate
- * by insufficient material to checkmate
+/* Returns 0x2 if the current position is checkmate
+ * Returns 0 otherwise
+ *
+ * which_color must be the side to move.
  */
-int check_stalemate(Board* board, int which_color)
+int is_checkmate(Board* board, int which_color)
 {
     int king_attacked = (which_color) ? board->bking_pos : board->wking_pos;
-    uint8_t color = board->position[king_attacked] & 0x80;
     print_debug("KING: %d\n", king_attacked);
-    if (is_attacked(board, king_attacked))
+    if (!is_attacked(board, king_attacked))
         return 0;
+    print_debug("is attacked\n");
+    PackedMove moves[MOVES_PER_POSITION];
+    if (generate_moves(board, moves, GEN_ALL))
+        return 0;
+    print_debug("can't move\n");
+    return 0x2;
+}
+
+/* Returns 0x10 if the current position has now occurred three times
+ * Returns 0 otherwise
+ *
+ * Only positions with the same side to move since the last capture or pawn
+ * move can repeat, so just those keys are compared.
+ */
+int check_threefold(Game* game)
+{
+    Board* board = &game->board;
+    int oldest = game->history_count - board->halfmoves;
+    if (oldest < 0)
+        oldest = 0;
+    int count = 1;
     int i;
-    int p = 0, b = 0, n = 0, r = 0, q = 0, k = 0;
-    int bp = 0, bb = 0, bn = 0, br = 0, bq = 0, bk = 0;
-    for(i = 0; i < 64; ++i)
-    {
-        uint8_t piece = board->position[i];
-        if (piece & PAWN)
-            (piece & 0x80) ? bp++ : p++;
-        else if (piece & BISHOP)
-            (piece & 0x80) ? bb++ : b++;
-        else if (piece & KNIGHT)
-            (piece & 0x80) ? bn++ : n++;
-        else if (piece & ROOK)
-            (piece & 0x80) ? br++ : r++;
-        else if (piece & QUEEN)
-            (piece & 0x80) ? bq++ : q++;
-        else if (piece & KING)
-            (piece & 0x80) ? bk++ : k++;
-    }
-    if (!(p || r || q || bp || br || bq))
+    for (i = game->history_count - 2; i >= oldest; i -= 2)
     {
-        int stale_white = 0;
-        int stale_black = 0;
-        if ((!n && b <= 1) || (!b && n <= 1))
-            stale_white = 1;
-        if ((!bn && bb <= 1) || (!bb && bn <= 1))
-            stale_black = 1;
-        if (stale_black && stale_white)
-            return 0x4;
+        if (game->keys[i] == board->hash && ++count >= 3)
+            return 0x10;
     }
-    if (king_attacked + UP >= 0 && king_attacked / 8 > 0)
-        if (is_legal(board, king_attacked + UP, king_attacked))
-            return 0;
-    print_debug("can move up\n");
-    if (king_attacked + UPR >= 0 && king_attacked + UPR < 64)
-        if (king_attacked % 8 < 7 && king_attacked / 8 > 0)
-            if (is_legal(board, king_attacked + UPR, king_attacked))
-                return 0;
-    print_debug("upr\n");
-    if (king_attacked + UPL >= 0 && king_attacked + UPL < 64)
-        if (king_attacked % 8 > 0 && king_attacked / 8 > 0)
-            if (is_legal(board, king_attacked + UPL, king_attacked))
-                return 0;
-    print_debug("upl\n");
-    if (king_attacked + LEFT >= 0 && king_attacked % 8 > 0)
-        if (is_legal(board, king_attacked + LEFT, king_attacked))
-            return 0;
-    print_debug("left\n");
-    if (king_attacked + RIGHT < 64 && king_attacked % 8 < 7)
-        if (is_legal(board, king_attacked + RIGHT, king_attacked))
-            return 0;
-    print_debug("right\n");
-    if (king_attacked + DOWNL >= 0 && king_attacked + DOWNL < 64)
-        if (king_attacked % 8 > 0 && king_attacked / 8 < 7)
-            if (is_legal(board, king_attacked + DOWNL, king_attacked))
-                return 0;
-    print_debug("downl\n");
-    if (king_attacked + DOWNR >= 0 && king_attacked + DOWNR < 64)
-        if (king_attacked % 8 < 7 && king_attacked / 8 < 7)
-            if (is_legal(board, king_attacked + DOWNR, king_attacked))
-                return 0;
-    print_debug("downr\n");
-    if (king_attacked + DOWN < 64 && king_attacked / 8 < 7)
-        if (is_legal(board, king_attacked + DOWN, king_attacked))
-            return 0;
-    print_debug("down\n");
-    for (i = 0; i < 64; i++ )
+    return 0;
+}
+
+/* Adds a move from src to each square of targets */
+static int add_moves(PackedMove* moves, int count, int src, uint64_t targets)
+{
+    while (targets)
+        moves[count++] = PACK_MOVE(src, pop_lsb(&targets), 0);
+    return count;
+}
+
+/* Adds the pawn moves from src to each square of targets, with a separate
+ * move for each promotion piece on the last rank
+ */
+static int add_pawn_moves(PackedMove* moves, int count, int src,
+        uint64_t targets)
+{
+    /* Queen, rook, bishop, knight */
+    const int promotions[4] = {4, 3, 1, 2};
+    while (targets)
     {
-        if ((board->position[i] & 0x80) != color || i != king_attacked)
+        int dest = pop_lsb(&targets);
+        if (dest / 8 == 0 || dest / 8 == 7)
         {
-            uint8_t orig_piece = board->position[i];
-            Found founds;
-            find_attacker(board, i, (ALL_PIECES & (~KING)) | color, &founds);
-            if (founds.num_found)
-                return 0;
-            board->position[i] = orig_piece;
+            int k;
+            for (k = 0; k < 4; ++k)
+                moves[count++] = PACK_MOVE(src, dest, promotions[k]);
         }
+        else
+            moves[count++] = PACK_MOVE(src, dest, 0);
     }
-    return 0x4;
+    return count;
 }
 
-/* Returns 1 if the current position is checkmate
- * Returns 0 otherwise
+/* Adds a pawn move to each square of targets from the square offset behind
+ * it, with a separate move for each promotion piece on the last rank
  */
-int is_checkmate(Board* board, int which_color)
+static int add_pawn_targets(PackedMove* moves, int count, uint64_t targets,
+        int offset)
 {
-    int king_attacked = (which_color) ? board->bking_pos : board->wking_pos;
-    print_debug("KING: %d\n", king_attacked);
-    if (!is_attacked(board, king_attacked))
-        return 0;
-    print_debug("is attacked\n");
-    uint8_t color = board->position[king_attacked] & 0x80;
-    int i;
-    if (king_attacked + UP >= 0 && king_attacked / 8 > 0)
-        if (is_legal(board, king_attacked + UP, king_attacked))
-            return 0;
-    print_debug("can move up\n");
-    if (king_attacked + UPR >= 0 && king_attacked + UPR < 64)
-        if (king_attacked % 8 < 7 && king_attacked / 8 > 0)
-            if (is_legal(board, king_attacked + UPR, king_attacked))
-                return 0;
-    print_debug("upr\n");
-    if (king_attacked + UPL >= 0 && king_attacked + UPL < 64)
-        if (king_attacked % 8 > 0 && king_attacked / 8 > 0)
-            if (is_legal(board, king_attacked + UPL, king_attacked))
-                return 0;
-    print_debug("upl\n");
-    if (king_attacked + LEFT >= 0 && king_attacked % 8 > 0)
-        if (is_legal(board, king_attacked + LEFT, king_attacked))
-            return 0;
-    print_debug("left\n");
-    if (king_attacked + RIGHT < 64 && king_attacked % 8 < 7)
-        if (is_legal(board, king_attacked + RIGHT, king_attacked))
-            return 0;
-    print_debug("right\n");
-    if (king_attacked + DOWNL >= 0 && king_attacked + DOWNL < 64)
-        if (king_attacked % 8 > 0 && king_attacked / 8 < 7)
-            if (is_legal(board, king_attacked + DOWNL, king_attacked))
-                return 0;
-    print_debug("downl\n");
-    if (king_attacked + DOWNR >= 0 && king_attacked + DOWNR < 64)
-        if (king_attacked % 8 < 7 && king_attacked / 8 < 7)
-            if (is_legal(board, king_attacked + DOWNR, king_attacked))
-                return 0;
-    print_debug("downr\n");
-    if (king_attacked + DOWN < 64 && king_attacked / 8 < 7)
-        if (is_legal(board, king_attacked + DOWN, king_attacked))
-            return 0;
-    print_debug("down\n");
-    print_debug("can't move\n");
-    for (i = 0; i < 64; ++i)
+    while (targets)
     {
-        if (i != king_attacked)
+        int dest = pop_lsb(&targets);
+        count = add_pawn_moves(moves, count, dest - offset, SQUARE_BB(dest));
+    }
+    return count;
+}
+
+/* Adds a move to dest from each square of sources */
+static int add_moves_to(PackedMove* moves, int count, int dest,
+        uint64_t sources)
+{
+    while (sources)
+        moves[count++] = PACK_MOVE(pop_lsb(&sources), dest, 0);
+    return count;
+}
+
+/* Adds the moves of type that get the king of us out of the check described
+ * by info. Instead of generating every piece's moves and masking them, this
+ * looks backwards from the few squares that can answer a single check, the
+ * checker and the squares between it and the king, for the pieces that reach
+ * them. A pinned piece can never answer a check, so pinned pieces are skipped
+ * and no pin tests are needed. Double checks only get king moves.
+ */
+static inline __attribute__((always_inline))
+int generate_evasions(Board* board, PackedMove* moves, int type,
+        CheckInfo* info, const int us)
+{
+    const uint64_t last_rank = (us) ? RANK_1 : RANK_8;
+    const uint64_t double_rank = (us) ? RANK_8 << 16 : RANK_1 >> 16;
+    const int forward = (us) ? DOWN : UP;
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    uint64_t targets = 0;
+    int count = 0;
+    if (type & GEN_CAPTURES)
+        targets |= board->occupied[!us];
+    if (type & GEN_QUIETS)
+        targets |= ~occupied;
+
+    count = add_moves(moves, count, info->king,
+            king_attacks(info->king) & targets & ~info->danger);
+    if (info->checkers & (info->checkers - 1))
+        return count;
+
+    int checker = __builtin_ctzll(info->checkers);
+    uint64_t blocks = between_squares[info->king][checker];
+    uint64_t ours = board->occupied[us] & ~info->pinned
+                  & ~SQUARE_BB(info->king);
+    uint64_t pawns = board->pieces[TYPE_INDEX(PAWN)] & ours;
+    uint64_t pieces = ours & ~pawns;
+    uint64_t queens = board->pieces[TYPE_INDEX(QUEEN)];
+    uint64_t knights = board->pieces[TYPE_INDEX(KNIGHT)] & pieces;
+    uint64_t rooks = (board->pieces[TYPE_INDEX(ROOK)] | queens) & pieces;
+    uint64_t bishops = (board->pieces[TYPE_INDEX(BISHOP)] | queens) & pieces;
+
+    if (type & GEN_CAPTURES)
+    {
+        count = add_moves_to(moves, count, checker,
+                (knight_attacks(checker) & knights)
+              | (rook_attacks(checker, occupied) & rooks)
+              | (bishop_attacks(checker, occupied) & bishops));
+        count = add_pawn_targets(moves, count,
+                pawn_attacks_west(pawns, us) & info->checkers,
+                forward + LEFT);
+        count = add_pawn_targets(moves, count,
+                pawn_attacks_east(pawns, us) & info->checkers,
+                forward + RIGHT);
+
+        /* A pawn that gave check with a double push can be taken en
+         * passant. Only the pawn itself is removed, so the capturing pawn
+         * just has to be unpinned.
+         */
+        if (board->en_p / 8 == ((us) ? 5 : 2) &&
+                checker == board->en_p - forward)
+            count = add_moves_to(moves, count, board->en_p,
+                    pawn_attacks(board->en_p, !us) & pawns);
+    }
+
+    /* Pawn pushes onto the last rank are promotions and count as captures */
+    uint64_t single = shift_forward(pawns, us) & ~occupied;
+    uint64_t twice = shift_forward(single & double_rank, us) & ~occupied
+                   & blocks;
+    single &= blocks;
+    if (type & GEN_CAPTURES)
+        count = add_pawn_targets(moves, count, single & last_rank, forward);
+    if (type & GEN_QUIETS)
+    {
+        count = add_pawn_targets(moves, count, single & ~last_rank, forward);
+        count = add_pawn_targets(moves, count, twice, 2 * forward);
+        while (blocks)
         {
-            uint8_t orig_piece = board->position[i];
-            board->position[i] = PAWN | color;
-            if (!is_attacked(board, king_attacked) || i == board->en_p)
-            {
-                board->position[i] = orig_piece;
-                if (i == board->en_p)
-                {
-                    Found en_found;
-                    find_attacker(board, i,PAWN|color, &en_found);
-                    if (!en_found.num_found)
-                        continue;
-                }
-                Found founds;
-                find_attacker(board, i, (ALL_PIECES & (~KING))|color, &founds);
-                if (founds.num_found)
-                {
-                    print_debug("%c%d can be blocked by ", i%8+'a', 8-i/8);
-                    int j;
-                    for (j = 0; j < founds.num_found; ++j)
-                        print_debug("%c%d ", founds.squares[j]%8+'a',
-                                8-founds.squares[j]/8);
-                    print_debug("\n");
-                    return 0;
-                }
-            }
-            board->position[i] = orig_piece;
+            int block = pop_lsb(&blocks);
+            count = add_moves_to(moves, count, block,
+                    (knight_attacks(block) & knights)
+                  | (rook_attacks(block, occupied) & rooks)
+                  | (bishop_attacks(block, occupied) & bishops));
         }
     }
-    return 0x2;
+    return count;
 }
 
-/* Returns 2 if the current position is stalemate by three-fold repetition
- * Returns 0 otherwise
+/* The body of generate_moves() for one side, us being 0 for white and 1 for
+ * black. It is only called with a constant us and always inlined, so there
+ * is a copy for each color with the pawn direction, promotion rank and
+ * castling squares folded in as constants.
  */
-int check_threefold(Board* board)
+static inline __attribute__((always_inline))
+int generate_side(Board* board, PackedMove* moves, int type, const int us)
 {
-    int i;
-    int j;
-    for (i = 0; i < board->pos_count; ++i)
+    const uint8_t color = (us) ? BLACK : WHITE;
+    const uint64_t last_rank = (us) ? RANK_1 : RANK_8;
+    const uint64_t double_rank = (us) ? RANK_8 << 16 : RANK_1 >> 16;
+    const int forward = (us) ? DOWN : UP;
+    const int home = (us) ? 4 : 60;
+    const uint8_t kingside = (us) ? 0x02 : 0x08;
+    const uint8_t queenside = (us) ? 0x01 : 0x04;
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    uint64_t enemies = board->occupied[!us];
+    uint64_t targets = 0;
+    int count = 0;
+    CheckInfo info;
+    get_check_info(board, &info);
+    if (info.checkers)
+        return generate_evasions(board, moves, type, &info, us);
+    if (type & GEN_CAPTURES)
+        targets |= enemies;
+    if (type & GEN_QUIETS)
+        targets |= ~occupied;
+
+    uint64_t pawns = board->pieces[TYPE_INDEX(PAWN)] & board->occupied[us];
+    uint64_t pieces = board->occupied[us] & ~pawns & ~SQUARE_BB(info.king);
+    while (pieces)
+    {
+        int src = pop_lsb(&pieces);
+        uint64_t allowed = ~0ULL;
+        if (info.pinned & SQUARE_BB(src))
+            allowed = line_squares[info.king][src];
+        count = add_moves(moves, count, src,
+                piece_attacks(board->position[src], src, occupied)
+                & targets & allowed);
+    }
+
+    /* Unpinned pawns move together, a shift of the whole set per kind of
+     * move
+     */
+    uint64_t free_pawns = pawns & ~info.pinned;
+    uint64_t single = shift_forward(free_pawns, us) & ~occupied;
+    uint64_t twice = shift_forward(single & double_rank, us) & ~occupied;
+    if (type & GEN_CAPTURES)
+    {
+        count = add_pawn_targets(moves, count,
+                pawn_attacks_west(free_pawns, us) & enemies, forward + LEFT);
+        count = add_pawn_targets(moves, count,
+                pawn_attacks_east(free_pawns, us) & enemies, forward + RIGHT);
+        count = add_pawn_targets(moves, count, single & last_rank, forward);
+    }
+    if (type & GEN_QUIETS)
     {
-        int count = 0;
-        for (j = 0; j < board->pos_count; ++j)
+        count = add_pawn_targets(moves, count, single & ~last_rank, forward);
+        count = add_pawn_targets(moves, count, twice, 2 * forward);
+    }
+
+    /* Pinned pawns can only move along the pin */
+    uint64_t pinned_pawns = pawns & info.pinned;
+    while (pinned_pawns)
+    {
+        int src = pop_lsb(&pinned_pawns);
+        uint64_t push = shift_forward(SQUARE_BB(src), us) & ~occupied;
+        uint64_t found = 0;
+        push |= shift_forward(push & double_rank, us) & ~occupied;
+        if (type & GEN_CAPTURES)
+            found |= (pawn_attacks(src, color) & enemies)
+                   | (push & last_rank);
+        if (type & GEN_QUIETS)
+            found |= push & ~last_rank;
+        count = add_pawn_moves(moves, count, src,
+                found & line_squares[info.king][src]);
+    }
+
+    if ((type & GEN_CAPTURES) && board->en_p / 8 == ((us) ? 5 : 2))
+    {
+        uint64_t takers = pawn_attacks(board->en_p, !us) & pawns;
+        while (takers)
         {
-            if (!strcmp(board->position_hist[i], board->position_hist[j]))
-                count++;
+            int src = pop_lsb(&takers);
+            if (!king_attacked_after(board, board->en_p, src,
+                        board->en_p - forward))
+                moves[count++] = PACK_MOVE(src, board->en_p, 0);
         }
-        if (count >= 3)
-            return 0x10;
     }
-    return 0;
+
+    count = add_moves(moves, count, info.king,
+            king_attacks(info.king) & targets & ~info.danger);
+    /* The king is not in check, so the squares it passes are only attacked
+     * if they are danger squares
+     */
+    if ((type & GEN_QUIETS) && info.king == home)
+    {
+        uint64_t short_path = SQUARE_BB(home + 1) | SQUARE_BB(home + 2);
+        uint64_t long_path = SQUARE_BB(home - 1) | SQUARE_BB(home - 2);
+        if ((board->castling & kingside) &&
+                !(occupied & short_path) && !(info.danger & short_path))
+            moves[count++] = PACK_MOVE(home, home + 2 * RIGHT, 0);
+        if ((board->castling & queenside) &&
+                !(occupied & (long_path | SQUARE_BB(home - 3))) &&
+                !(info.danger & long_path))
+            moves[count++] = PACK_MOVE(home, home + 2 * LEFT, 0);
+    }
+    return count;
+}
+
+/* Fills moves with the legal moves of type for the side to play and returns
+ * how many there are. GEN_CAPTURES gives captures, en passant and
+ * promotions, GEN_QUIETS every other move and GEN_ALL both. Each promotion
+ * piece is a separate move. moves must have room for MOVES_PER_POSITION
+ * moves.
+ *
+ * Moves are generated forwards from the pieces of the side to play, with the
+ * pins of the position masking off illegal targets. A side in check gets
+ * only its evasions, found by generate_evasions().
+ */
+int generate_moves(Board* board, PackedMove* moves, int type)
+{
+    if (board->to_move)
+        return generate_side(board, moves, type, 1);
+    return generate_side(board, moves, type, 0);
 }
 
-/* Returns 1 if the current position is checkmate
- * Returns 2 if the current position is stalemate
+/* Returns the Move that move_piece() and the game history expect for a
+ * packed move of the side to play on board
+ */
+Move unpack_move(Board* board, PackedMove move)
+{
+    Move result = default_move;
+    int src = MOVE_SRC(move);
+    uint8_t color = (board->to_move) ? BLACK : WHITE;
+    result.dest = MOVE_DEST(move);
+    result.src_rank = src / 8;
+    result.src_file = src % 8;
+    result.src_piece = board->position[src];
+    result.promotion |= color;
+    if (MOVE_PROMOTION(move))
+        result.promotion = (1 << MOVE_PROMOTION(move)) | color;
+    return result;
+}
+
+/* Returns 0x2 if the current position is checkmate
+ * Returns 0x4 if it is stalemate or neither side can mate
+ * Returns 0x8 or 0x10 for a draw by the 50 move rule or repetition
  * Returns 0 otherwise
+ *
+ * Mate and stalemate both come from a single count of the legal moves.
  */
-int is_gameover(Board* board)
+int is_gameover(Game* game)
 {
-    if (board->history_count >= MAX_HISTORY)
-    {
-        printf("MAXIMUM HISTORY (%u) REACHED\n", MAX_HISTORY);
-        return 0x20;
-    }
-    if (board->pos_count >= MAX_STORED_POSITIONS)
+    Board* board = &game->board;
+    PackedMove moves[MOVES_PER_POSITION];
+    int game_over = 0;
+    if (!generate_moves(board, moves, GEN_ALL))
     {
-        printf("MAXIMUM POSITIONS (%u) REACHED\n", MAX_STORED_POSITIONS);
-        return 0x40;
+        int king = (board->to_move) ? board->bking_pos : board->wking_pos;
+        game_over = (is_attacked(board, king)) ? 0x2 : 0x4;
     }
-    int game_over = is_checkmate(board, board->to_move);
-    print_debug("was checkmate? %d\n", game_over);
-    if (!game_over)
-        game_over = check_stalemate(board, board->to_move);
-    print_debug("was stalemate? %d\n", game_over);
+    print_debug("was mate or stalemate? %d\n", game_over);
+    if (!game_over && insufficient_material(board))
+        game_over = 0x4;
     if (!game_over && board->halfmoves >= 100)
         game_over = 0x8;
     print_debug("was 50-move? %d\n", game_over);
-    if (!game_over && board->pos_count)
-        game_over = check_threefold(board);
+    if (!game_over)
+        game_over = check_threefold(game);
 
-    if (board->history_count > 0)
-        board->history[board->history_count - 1].game_over = game_over;
+    if (game->history_count > 0)
+        game->history[game->history_count - 1].game_over = game_over;
     return game_over;
 }
 
-void stress_test(Board* board, int times)
+/* Castling rights kept when a piece moves from or to each square */
+static uint8_t castling_mask(int square)
 {
-    int i;
-    for (i = 0; i < times; ++i)
+    switch (square)
     {
-        int j;
-        for (j = 0; j < 64; ++j)
-        {
-            Found founds;
-            find_attacker(board, j, ALL_PIECES, &founds);
-        }
+        case 0:  return 0xFE;
+        case 4:  return 0xFC;
+        case 7:  return 0xFD;
+        case 56: return 0xFB;
+        case 60: return 0xF3;
+        case 63: return 0xF7;
+        default: return 0xFF;
     }
 }
 
-/* Stores partial FEN for current position 
- * used in three-fold repetition check
+/* Plays a legal move from src to dest on the board and records what is
+ * needed to take it back in undo. Castling is a king moving two files. A
+ * pawn reaching the last rank becomes promotion, a piece such as ROOK, or a
+ * queen if promotion is 0. Unlike move_piece() nothing is validated, printed
+ * or added to the game history, so it is cheap enough for search.
  */
-void store_position(Board* board, char* dest)
+static void play_move(Board* board, int src, int dest, uint8_t promotion,
+        Undo* undo)
 {
-    int str_ind = 0;
-    int i;
-    for (i = 0; i < MAX_POSITION_STRING; ++i)
-        dest[i] = 0;
-    int empty = 0;
-    for (i = 0; i < 64; ++i)
+    uint8_t piece = board->position[src];
+    uint8_t color = piece & 0x80;
+    undo->hash = board->hash;
+    undo->src = src;
+    undo->dest = dest;
+    undo->piece = piece;
+    undo->castling = board->castling;
+    undo->en_p = board->en_p;
+    undo->halfmoves = board->halfmoves;
+    undo->captured_square = dest;
+    if ((piece & PAWN) && dest == board->en_p && dest % 8 != src % 8)
+        undo->captured_square = dest + ((color) ? UP : DOWN);
+    undo->captured = board->position[undo->captured_square];
+
+    if (undo->captured)
+        set_square(board, undo->captured_square, 0);
+    move_square(board, dest, src);
+    board->en_p = -1;
+    board->halfmoves++;
+    if (piece & PAWN)
     {
-        uint8_t square = board->position[i];
-        if (i % 8 == 0 && i)
-        {
-            if (empty)
-            {
-                dest[str_ind++] = '0' + empty;
-                empty = 0;
-            }
-            dest[str_ind++] = '/';
-        }
-        if (square)
-        {
-            if (empty)
-            {
-                dest[str_ind++] = '0' + empty;
-                empty = 0;
-            }
-            if (square & KNIGHT)
-                dest[str_ind] = 'N';
-            else if (square & PAWN)
-                dest[str_ind] = 'P';
-            else if (square & BISHOP)
-                dest[str_ind] = 'B';
-            else if (square & ROOK)
-                dest[str_ind] = 'R';
-            else if (square & QUEEN)
-                dest[str_ind] = 'Q';
-            else if (square & KING)
-                dest[str_ind] = 'K';
-            if (square & BLACK)
-                dest[str_ind] += 32;
-            str_ind++;
-        }
-        else
-            empty++;
+        board->halfmoves = 0;
+        if (dest - src == 2 * DOWN || dest - src == 2 * UP)
+            board->en_p = (src + dest) / 2;
+        else if (dest / 8 == 0 || dest / 8 == 7)
+            set_square(board, dest, ((promotion) ? promotion : QUEEN) | color);
     }
+    else if ((piece & KING) && dest - src == 2 * RIGHT)
+        move_square(board, dest + LEFT, dest + RIGHT);
+    else if ((piece & KING) && dest - src == 2 * LEFT)
+        move_square(board, dest + RIGHT, dest + 2 * LEFT);
+    if (undo->captured)
+        board->halfmoves = 0;
+    board->castling &= castling_mask(src) & castling_mask(dest);
+    if (color)
+        board->moves++;
+    board->to_move = !board->to_move;
+    board->hash ^= zobrist_black
+                 ^ zobrist_castling[undo->castling & 0x0F]
+                 ^ zobrist_castling[board->castling & 0x0F];
+    if (undo->en_p != -1)
+        board->hash ^= zobrist_en_p[undo->en_p % 8];
+    if (board->en_p != -1)
+        board->hash ^= zobrist_en_p[board->en_p % 8];
+}
+
+/* Plays move on the board, see play_move() */
+void make_move(Board* board, Move* move, Undo* undo)
+{
+    play_move(board, move->src_rank * 8 + move->src_file, move->dest,
+            move->promotion & (KNIGHT | BISHOP | ROOK | QUEEN), undo);
+}
 
-    if (empty)
-        dest[str_ind++] = '0' + empty;
+/* Plays a packed move on the board, see play_move() */
+void make_packed_move(Board* board, PackedMove move, Undo* undo)
+{
+    uint8_t promotion = 0;
+    if (MOVE_PROMOTION(move))
+        promotion = 1 << MOVE_PROMOTION(move);
+    play_move(board, MOVE_SRC(move), MOVE_DEST(move), promotion, undo);
+}
 
-    dest[str_ind++] = ' ';
+/* Takes back the move recorded in undo by make_move() */
+void unmake_move(Board* board, Undo* undo)
+{
+    int src = undo->src;
+    int dest = undo->dest;
+    board->to_move = !board->to_move;
     if (board->to_move)
-        dest[str_ind++] = 'b';
-    else
-        dest[str_ind++] = 'w';
-    dest[str_ind++] = ' ';
-    if (board->castling & 0x08)
-        dest[str_ind++] = 'K';
-    if (board->castling & 0x04)
-        dest[str_ind++] = 'Q';
-    if (board->castling & 0x02)
-        dest[str_ind++] = 'k';
-    if (board->castling & 0x01)
-        dest[str_ind++] = 'q';
-    if (!board->castling)
-        dest[str_ind++] = '-';
-    dest[str_ind++] = ' ';
+        board->moves--;
+    if ((undo->piece & KING) && dest - src == 2 * RIGHT)
+        move_square(board, dest + RIGHT, dest + LEFT);
+    else if ((undo->piece & KING) && dest - src == 2 * LEFT)
+        move_square(board, dest + 2 * LEFT, dest + RIGHT);
+    move_square(board, src, dest);
+    set_square(board, src, undo->piece);
+    if (undo->captured)
+        set_square(board, undo->captured_square, undo->captured);
+    board->castling = undo->castling;
+    board->en_p = undo->en_p;
+    board->halfmoves = undo->halfmoves;
+    board->hash = undo->hash;
+}
+
+/* Passes the turn to the other side without moving, for null move pruning.
+ * Any en passant capture is given up along with the turn.
+ */
+void make_null_move(Board* board, Undo* undo)
+{
+    undo->hash = board->hash;
+    undo->en_p = board->en_p;
+    undo->halfmoves = board->halfmoves;
+    board->hash ^= zobrist_black;
     if (board->en_p != -1)
-    {
-        dest[str_ind++] = board->en_p % 8 + 'a';
-        dest[str_ind++] = 8 - board->en_p / 8 + '0';
-    }
-    else
-        dest[str_ind++] = '-';
-    dest[str_ind] = '\0';
+        board->hash ^= zobrist_en_p[board->en_p % 8];
+    board->en_p = -1;
+    board->halfmoves++;
+    board->to_move = !board->to_move;
+}
+
+/* Takes back the pass recorded in undo by make_null_move() */
+void unmake_null_move(Board* board, Undo* undo)
+{
+    board->to_move = !board->to_move;
+    board->en_p = undo->en_p;
+    board->halfmoves = undo->halfmoves;
+    board->hash = undo->hash;
 }
 
 /* Makes a move on the board based on given Move struct and updates board state
  * Use this function when submitting an actual move on the board
  * Returns 0 for successful move, error otherwise
  */
-int move_piece(Board* board, Move* move)
+int move_piece(Game* game, Move* move)
 {
+    Board* board = &game->board;
 
     /* Get list of valid moves */
     Found found;
@@ -1170,14 +1300,13 @@ int move_piece(Board* board, Move* move)
             print_debug("%c%d\n",
                     temp_fnd.squares[i]%8+'a',8-temp_fnd.squares[i]/8);
         }
-        board->to_move = BLACK;
     }
     if (!board->to_move && is_attacked(board, board->wking_pos))
     {
         print_debug("    yes.\n");
         Found temp_fnd;
         board->to_move = !board->to_move;
-        find_attacker(board, board->bking_pos, ALL_PIECES, &temp_fnd);
+        find_attacker(board, board->wking_pos, ALL_PIECES, &temp_fnd);
         board->to_move = !board->to_move;
         print_debug("attackers: %d\n", temp_fnd.num_found);
         int i;
@@ -1186,7 +1315,6 @@ int move_piece(Board* board, Move* move)
             print_debug("%c%d\n",
                     temp_fnd.squares[i]%8+'a',8-temp_fnd.squares[i]/8);
         }
-        board->to_move = WHITE;
     }
         
 
@@ -1270,96 +1398,41 @@ int move_piece(Board* board, Move* move)
     }
     else
     {
-        Move* record = &(board->history[board->history_count]);
+        Move* record = next_record(game);
+        Move made = *move;
+        game->keys[game->history_count] = board->hash;
+        Undo undo;
+        made.src_rank = move_to / 8;
+        made.src_file = move_to % 8;
         if (move->castle != -1)
         {
             print_debug("CASTLING\n");
-            int success = castle(board, move->castle);
-            if (!success)
-                printf("Move not valid.\n");
-            else
+            if (!castle(board, move->castle))
             {
-                if (move->castle == 0)
-                {
-                    if (board->to_move)
-                    {
-                        move_square(board, 6, 4);
-                        move_square(board, 5, 7);
-                        board->castling &= 0xFC;
-                    }
-                    else
-                    {
-                        move_square(board, 62, 60);
-                        move_square(board, 61, 63);
-                        board->castling &= 0xF3;
-                    }
-                }
-                else if (move->castle == 1)
-                {
-                    if (board->to_move)
-                    {
-                        move_square(board, 2, 4);
-                        move_square(board, 3, 0);
-                        board->castling &= 0xFC;
-                    }
-                    else
-                    {
-                        move_square(board, 58, 60);
-                        move_square(board, 59, 56);
-                        board->castling &= 0xF3;
-                    }
-                }
-                record->castle = move->castle;
-                record->src_piece = 0;
+                printf("Move not valid.\n");
+                return -1;
             }
+            made.dest = (move->castle) ? move_to - 2 : move_to + 2;
+            make_move(board, &made, &undo);
+            record->castle = move->castle;
+            record->src_piece = 0;
         }
         else
         {
+            make_move(board, &made, &undo);
             record->dest = move->dest;
             record->src_piece = move->src_piece;
             if (rank_match)
                 record->src_rank = move->src_rank;
             if (file_match)
                 record->src_file = move->src_file;
-            record->piece_taken = board->position[move->dest];
-            move_square(board, move->dest, move_to);
-            if (move->src_piece == (KING | BLACK))
-                board->bking_pos = move->dest;
-            else if (move->src_piece == KING)
-                board->wking_pos = move->dest;
-            if (found.en_p_taken != -1)
-            {
-                record->piece_taken = board->position[found.en_p_taken];
-                board->position[found.en_p_taken] = 0;
-            }
-            board->halfmoves++;
-            if (found.made_en_p == -1)
-                board->en_p = -1;
-            else
-                board->en_p = found.made_en_p;
-            if (move->src_piece & PAWN)
-            {
-                board->pos_count = 0;
-                board->halfmoves = 0;
-                if (record->piece_taken)
-                    record->src_file = move_to % 8;
-            }
-            if (record->piece_taken)
-            {
-                board->pos_count = 0;
-                board->halfmoves = 0;
-            }
-            if (found.promotion)
-            {
-                board->position[move->dest] = move->promotion;
-                record->promotion = move->promotion;
-            }
+            record->piece_taken = undo.captured;
+            if ((move->src_piece & PAWN) && record->piece_taken)
+                record->src_file = move_to % 8;
+            if (undo.piece != board->position[move->dest])
+                record->promotion = board->position[move->dest];
         }
-        store_position(board, board->position_hist[board->pos_count++]);
-        board->history_count++;
-        if (board->to_move)
-            board->moves++;
-        board->to_move = !board->to_move;
+        game->history_count++;
         uint8_t curr_king;
         if (board->to_move)
             curr_king = board->bking_pos;
@@ -1368,30 +1441,13 @@ int move_piece(Board* board, Move* move)
         if (is_attacked(board, curr_king))
             record->gave_check = 1;
     }
-
-    /* Update castling permissions */
-    if (board->castling & 0x08)
-        if (board->position[60] != ( KING|WHITE) ||
-                board->position[63] != (ROOK|WHITE))
-            board->castling &= 0xF7;
-    if (board->castling & 0x04)
-        if (board->position[60] != ( KING|WHITE) ||
-                board->position[56] != (ROOK|WHITE))
-            board->castling &= 0xFB;
-    if (board->castling & 0x02)
-        if (board->position[4] != ( KING|BLACK) ||
-                board->position[7] != (ROOK|BLACK))
-            board->castling &= 0xFD;
-    if (board->castling & 0x01)
-        if (board->position[4] != ( KING|BLACK) ||
-                board->position[0] != (ROOK|BLACK))
-            board->castling &= 0xFE;
     return 0;
 }
 
 /* Interprets Standard Algebraic Notation and makes a move */
-int move_san(Board* board, char* move)
+int move_san(Game* game, char* move)
 {
+    Board* board = &game->board;
     Move this_move;
     this_move.src_piece = PAWN;
     this_move.promotion = QUEEN;
@@ -1462,5 +1518,5 @@ int move_san(Board* board, char* move)
     if (destrank != -1 && destfile != -1)
         this_move.dest = destrank * 8 + destfile;
 
-    return move_piece(board, &this_move);
+    return move_piece(game, &this_move);
 }
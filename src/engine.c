@@ -1,16 +1,154 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/time.h>
+#include "bitboard.h"
 #include "board.h"
 #include "engine.h"
 #include "io.h"
 
+#define MAX_SEARCH_DEPTH 64
+#define DEFAULT_SEARCH_HASH 16
+/* The score of being mated at the root. Mate ply plies from the root scores
+ * MATE_SCORE - ply, so nearer mates are preferred, and any score at least
+ * MATE_BOUND from 0 is a mate.
+ */
+#define MATE_SCORE 300
+#define MATE_BOUND (MATE_SCORE - MAX_SEARCH_DEPTH)
+/* Half width of the first aspiration window around the last iteration's
+ * score, in pawns
+ */
+#define ASPIRATION_WINDOW 1
+/* Selective search tuning. Margins are in pawns, like the evaluation. */
+#define FUTILITY_DEPTH 2
+#define FUTILITY_MARGIN 2
+#define NULL_MOVE_DEPTH 2
+#define NULL_VERIFY_DEPTH 6
+#define LMR_DEPTH 3
+#define LMR_MOVES 3
+/* What a capture has to be able to win beyond its victim to be searched in
+ * the quiescence search
+ */
+#define DELTA_MARGIN 2
+
 #ifdef DEBUG
 #define print_debug(...) fprintf(stderr,__VA_ARGS__)
 #else
 #define print_debug(...) ((void)0)
 #endif
 
+/* Positions searched by search_benchmark(), an opening, a middlegame full
+ * of tactics and an endgame
+ */
+static const char* bench_fens[] =
+{
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"
+};
+
+/* Stages of a MovePicker, in the order their moves are handed out */
+enum
+{
+    PICK_HASH,
+    PICK_GEN_CAPTURES,
+    PICK_GOOD_CAPTURES,
+    PICK_KILLERS,
+    PICK_GEN_QUIETS,
+    PICK_QUIETS,
+    PICK_BAD_CAPTURES,
+    PICK_DONE
+};
+
+/* Hands out the moves of a position one at a time with next_move(). Each
+ * stage is only generated and scored once the stage before it runs out, so
+ * a node that cuts off on an early move pays little for the rest.
+ */
+typedef struct
+{
+    int stage;
+    int index;
+    int count;
+    int bad_count;
+    int captures_only;
+    PackedMove hash_move;
+    PackedMove killers[2];
+    PackedMove moves[MOVES_PER_POSITION];
+    int16_t scores[MOVES_PER_POSITION];
+    PackedMove bad_captures[MOVES_PER_POSITION];
+} MovePicker;
+
+/* How a stored score relates to the true value of its position */
+enum
+{
+    BOUND_EXACT,
+    BOUND_LOWER,
+    BOUND_UPPER
+};
+
+/* A searched position in the search hash. score is for the side to move,
+ * like the values eval_prune() returns, and move is the best move found, or
+ * NULL_MOVE if every move failed low.
+ */
+typedef struct
+{
+    uint64_t key;
+    PackedMove move;
+    int16_t score;
+    uint8_t depth;
+    uint8_t bound;
+    uint8_t age;
+} HashEntry;
+
+/* Two entries share an index. deep keeps the deepest search of the current
+ * Econdensed() call and recent takes whatever deep turns away, so both
+ * expensive and fresh results survive.
+ */
+typedef struct
+{
+    HashEntry deep;
+    HashEntry recent;
+} HashBucket;
+
+/* Quiet moves that caused a beta cutoff, by ply from the root */
+static PackedMove killers[MAX_SEARCH_DEPTH][2];
+
+static HashBucket* search_hash = NULL;
+static uint64_t search_hash_mask = 0;
+/* The size the hash is allocated at on the first search. 0 turns it off. */
+static int search_hash_megabytes = DEFAULT_SEARCH_HASH;
+/* Counts one for each Econdensed() call, so older deep entries give way */
+static uint8_t search_age = 0;
+static uint64_t hash_probes = 0;
+static uint64_t hash_hits = 0;
+static uint64_t hash_cutoffs = 0;
+/* Positions visited by eval_prune() and by quiescence() since the last
+ * Econdensed() call
+ */
+static uint64_t search_nodes = 0;
+static uint64_t quiescence_nodes = 0;
+
+/* The principal variation found below each ply of the current iteration.
+ * pv_table[ply] holds the line from the position at ply, running from
+ * pv_table[ply][ply] up to pv_length[ply].
+ */
+static PackedMove pv_table[MAX_SEARCH_DEPTH + 1][MAX_SEARCH_DEPTH + 1];
+static int pv_length[MAX_SEARCH_DEPTH + 1];
+/* The principal variation of the last iteration, and whether the moves
+ * played to reach each ply of the current one follow it
+ */
+static PackedMove last_pv[MAX_SEARCH_DEPTH + 1];
+static int last_pv_length = 0;
+static int on_last_pv[MAX_SEARCH_DEPTH + 1];
+/* Whether the move that reached each ply was a null move, so two are never
+ * played in a row
+ */
+static int after_null[MAX_SEARCH_DEPTH + 1];
+/* The selective search features that are on, see set_search_pruning() */
+static int search_pruning = PRUNE_NULL_MOVE | PRUNE_LMR | PRUNE_FUTILITY;
+
 /* Prints the algebraic form of a square to stdout */
 void print_square(int i)
 {
@@ -37,12 +175,12 @@ int gives_checkmate(Board* board, int dest, int src)
     int result = is_checkmate(board, color);
     move_square(board, src, dest);
     board->to_move = !board->to_move;
-    board->position[dest] = original_piece;
+    set_square(board, dest, original_piece);
     return result;
 }
 
-/* Returns non-zero if src is covered by at least one other friendly piece.
- * use omit to specify a square that will not take part in the check
+/* Returns the number of pieces of the side to move covering src. Use omit to
+ * specify a square that will not take part in the check
  */
 int is_protected(Board* board, int src, int omit)
 {
@@ -50,20 +188,85 @@ int is_protected(Board* board, int src, int omit)
     if (omit != -1)
     {
         orig = board->position[omit];
-        board->position[omit] = 0;
+        set_square(board, omit, 0);
     }
-    Found found;
-    uint8_t orig_src = board->position[src];
-    uint8_t opp_color = (orig_src & 0x80) ^ 0x80;
-    board->position[src] = PAWN | opp_color;
-    find_attacker(board, src, ALL_PIECES, &found);
-    board->position[src] = orig_src;
-    int result = found.num_found;
+    int result = count_attackers(board, src, board->to_move != 0);
     if (omit != -1)
-        board->position[omit] = orig;
+        set_square(board, omit, orig);
     return result;
 }
 
+/* Returns the value of the least valuable piece of color attacking square,
+ * or 0 if there is none
+ */
+int lowest_attacker(Board* board, int square, int color)
+{
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    uint64_t attackers = attackers_to(board, square, occupied)
+                       & board->occupied[color];
+    int type;
+    for (type = 0; type < 6; ++type)
+    {
+        if (attackers & board->pieces[type])
+            return get_value(board,
+                    __builtin_ctzll(attackers & board->pieces[type]));
+    }
+    return 0;
+}
+
+/* Returns what the side to move wins or loses in material by playing the
+ * capture move and then trading off on its destination, each side
+ * recapturing with its least valuable piece for as long as that pays
+ * (static exchange evaluation). Pieces moved off the square's lines reveal
+ * the sliders behind them.
+ */
+int see(Board* board, PackedMove move)
+{
+    int src = MOVE_SRC(move);
+    int dest = MOVE_DEST(move);
+    int side = board->to_move != 0;
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    uint64_t from = SQUARE_BB(src);
+    int attacker = get_value(board, src);
+    int gain[32];
+    int depth = 0;
+    gain[0] = get_value(board, dest);
+    if (!board->position[dest] && (board->position[src] & PAWN) &&
+            dest % 8 != src % 8)
+    {
+        gain[0] = attacker; /* En passant */
+        occupied ^= SQUARE_BB(dest + ((side) ? -8 : 8));
+    }
+    do
+    {
+        depth++;
+        gain[depth] = attacker - gain[depth - 1];
+        if (-gain[depth - 1] < 0 && gain[depth] < 0)
+            break;
+        occupied ^= from;
+        side = !side;
+        uint64_t attackers = attackers_to(board, dest, occupied) & occupied
+                           & board->occupied[side];
+        int type;
+        from = 0;
+        for (type = 0; type < 6; ++type)
+        {
+            if (attackers & board->pieces[type])
+            {
+                from = SQUARE_BB(__builtin_ctzll(attackers
+                            & board->pieces[type]));
+                attacker = get_piece_value(1 << type);
+                break;
+            }
+        }
+    } while (from && depth < 31);
+    /* Each side stops trading when recapturing would lose more */
+    while (--depth)
+        if (gain[depth] > -gain[depth - 1])
+            gain[depth - 1] = -gain[depth];
+    return gain[0];
+}
+
 /* Returns non-zero if src is protected and none of the attackers are of lesser
  * value than it. This is because generally someone will take a piece of higher
  * value even if it means sacrifcing their piec. 
@@ -72,20 +275,12 @@ int is_safe(Board* board, int src)
 {
     if (!is_attacked(board, src))
         return 1;
-    board->to_move = !board->to_move;
-    Found found;
-    find_attacker(board, src, ALL_PIECES, &found);
-    board->to_move = !board->to_move;
-    int lowest_value = 9;
-    int i;
-    for (i = 0; i < found.num_found; ++i)
-    {
-        int curr = found.squares[i];
-        if (get_value(board, curr) < lowest_value)
-            lowest_value = get_value(board, curr);
-    }
+    int them = board->to_move == 0;
+    int lowest_value = lowest_attacker(board, src, them);
+    if (lowest_value > 9)
+        lowest_value = 9;
     if (lowest_value >= get_value(board, src) && 
-          found.num_found <= is_protected(board, src, -1))
+          count_attackers(board, src, them) <= is_protected(board, src, -1))
         return 1;
     return 0;
 }
@@ -101,7 +296,7 @@ int will_protect(Board* board, int dest, int src, int target)
     move_square(board, dest, src);
     int result = is_safe(board, target);
     move_square(board, src, dest);
-    board->position[dest] = original_piece;
+    set_square(board, dest, original_piece);
     return result;
 }
 
@@ -112,7 +307,7 @@ int will_be_attacked(Board* board, int dest, int src)
     move_square(board, dest, src);
     int result = is_attacked(board, dest);
     move_square(board, src, dest);
-    board->position[dest] = orig;
+    set_square(board, dest, orig);
     return result;
 }
 
@@ -125,7 +320,7 @@ int is_safe_move(Board* board, int dest, int src)
     move_square(board, dest, src);
     int result = is_safe(board, dest);
     move_square(board, src, dest);
-    board->position[dest] = orig;
+    set_square(board, dest, orig);
     return result;
 }
 
@@ -138,148 +333,482 @@ int comp_cand(const void* one, const void* two)
     return 0;
 }
 
-/* Gets all possible moves from the position and sorts them */
-void get_all_moves(Board* board, Candidate* cans)
+/* Fills cans with every legal move from the position, sorted by weight, and
+ * returns how many there are. cans must have room for MOVES_PER_POSITION
+ * candidates.
+ */
+int get_all_moves(Board* board, Candidate* cans)
 {
-    int i;
-    memset(cans, 0, sizeof(Candidate) * MOVES_PER_POSITION);
-    int cans_ind = 0;
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = generate_moves(board, moves, GEN_ALL);
     uint8_t color = (board->to_move) ? BLACK : WHITE;
-    for (i = 0; i < 64; ++i)
+    int i;
+    for (i = 0; i < count; ++i)
+    {
+        int src = MOVE_SRC(moves[i]);
+        int dest = MOVE_DEST(moves[i]);
+        cans[i].move = moves[i];
+        cans[i].weight = 1;
+        /* Gives checkmate */
+        /*
+        if (gives_checkmate(board, dest, src))
+            cans[i].weight += 100;
+        */
+        /* Gives check */
+        /*
+        if (gives_check(board, dest, src))
+            cans[i].weight++;
+        */
+        /* Is moving to a safe square */
+        if (is_safe_move(board, dest, src))
+            cans[i].weight += 4;
+        /* Takes a piece of higher value than itself */
+        if (get_value(board, dest) > get_value(board, src))
+            cans[i].weight++;
+        /* Takes an enemy piece */
+        if ((board->position[dest] & 0x80) == (color ^ 0x80))
+            cans[i].weight++;
+        /* Protects a hanging piece */
+        /*
+        if (will_protect(board, dest, src, hanging))
+            cans[i].weight++;
+        */
+    }
+    qsort(cans, count, sizeof(Candidate), comp_cand);
+    return count;
+}
+
+/* Returns non-zero if move is legal in the position. Hash moves and killers
+ * come from other positions, so they are checked before being played.
+ */
+int is_legal_move(Board* board, PackedMove move)
+{
+    int src = MOVE_SRC(move);
+    int dest = MOVE_DEST(move);
+    int us = board->to_move != 0;
+    uint8_t piece = board->position[src];
+    uint8_t target = board->position[dest];
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    if (move == NULL_MOVE || !piece || COLOR_INDEX(piece) != us ||
+            (target && COLOR_INDEX(target) == us))
+        return 0;
+    if (piece & PAWN)
     {
-        Found found;
-        find_attacker(board, i, ALL_PIECES | color, &found);
-        int j;
-        for (j = 0; j < found.num_found; ++j)
+        int forward = (us) ? 8 : -8;
+        int last_rank = dest / 8 == 0 || dest / 8 == 7;
+        if (last_rank != (MOVE_PROMOTION(move) != 0) ||
+                MOVE_PROMOTION(move) > TYPE_INDEX(QUEEN))
+            return 0;
+        if (pawn_attacks(src, us) & SQUARE_BB(dest))
         {
-            cans[cans_ind].move = default_move;
-            cans[cans_ind].move.dest = i;
-            cans[cans_ind].move.src_piece = board->position[found.squares[j]];
-            cans[cans_ind].move.src_rank = found.squares[j] / 8;
-            cans[cans_ind].move.src_file = found.squares[j] % 8;
-            cans[cans_ind].weight = 1;
-            /* Gives checkmate */
-            /*
-            if (gives_checkmate(board, i, found.squares[j]))
-                cans[cans_ind].weight += 100;
-            */
-            /* Gives check */
-            /*
-            if (gives_check(board, i, found.squares[j]))
-                cans[cans_ind].weight++;
-            */
-            /* Is moving to a safe square */
-            if (is_safe_move(board, i, found.squares[j]))
-                cans[cans_ind].weight += 4;
-            /* Takes a piece of higher value than itself */
-            if (get_value(board, i) > get_value(board, found.squares[j]))
-                cans[cans_ind].weight++;
-            /* Takes an enemy piece */
-            if ((board->position[i] & 0x80) == (color ^ 0x80))
-                cans[cans_ind].weight++;
-            /* Protects a hanging piece */
-            /*
-            if (will_protect(board, i, found.squares[j], hanging))
-                cans[cans_ind].weight++;
-            */
-            cans_ind++;
+            if (!target && dest != board->en_p)
+                return 0;
         }
+        else if (target || (dest != src + forward &&
+                    (dest != src + 2 * forward ||
+                     src / 8 != ((us) ? 1 : 6) ||
+                     board->position[src + forward])))
+            return 0;
     }
-    qsort(cans, MOVES_PER_POSITION, sizeof(Candidate), comp_cand);
+    else if (MOVE_PROMOTION(move))
+        return 0;
+    else if ((piece & KING) && (dest == src + 2 || dest == src - 2))
+        return src == ((us) ? 4 : 60) && castle(board, (dest > src) ? 0 : 1);
+    else if (!(piece_attacks(piece, src, occupied) & SQUARE_BB(dest)))
+        return 0;
+    return is_legal(board, dest, src);
 }
 
-/* Returns a random legal move */
-Move Erandom_move(Board* board)
+/* Returns non-zero if move is a legal quiet move in the position */
+int is_legal_quiet(Board* board, PackedMove move)
 {
-    print_debug("Playing Random Move\n");
-    Move move = default_move;
-    move.promotion = PAWN << (rand() % 4 + 1);
-    move.promotion |= (board->to_move) ? BLACK : WHITE;
-    while (move.dest == -1)
-    {
-        int start_square = rand() % 64;
-        uint8_t pieces = ALL_PIECES;
-        pieces |= (board->to_move) ? BLACK : WHITE;
-        Found found_moves;
-        find_attacker(board, start_square, pieces, &found_moves);
-        if (found_moves.num_found)
+    int src = MOVE_SRC(move);
+    int dest = MOVE_DEST(move);
+    if (board->position[dest] || MOVE_PROMOTION(move) ||
+            ((board->position[src] & PAWN) && dest % 8 != src % 8))
+        return 0;
+    return is_legal_move(board, move);
+}
+
+/* Sets the size of the search hash in megabytes, rounded down to a power of
+ * two number of buckets. 0 turns the hash off.
+ */
+void set_search_hash(int megabytes)
+{
+    free(search_hash);
+    search_hash = NULL;
+    search_hash_mask = 0;
+    search_hash_megabytes = (megabytes > 0) ? megabytes : 0;
+    if (megabytes <= 0)
+        return;
+    uint64_t buckets = 1;
+    while (buckets * 2 * sizeof(HashBucket) <= (uint64_t)megabytes << 20)
+        buckets *= 2;
+    search_hash = aligned_alloc(64, buckets * sizeof(HashBucket));
+    if (!search_hash)
+    {
+        printf("Couldn't allocate a %d MB search hash\n", megabytes);
+        search_hash_megabytes = 0;
+        return;
+    }
+    memset(search_hash, 0, buckets * sizeof(HashBucket));
+    search_hash_mask = buckets - 1;
+}
+
+/* Starts loading the bucket of key into the cache ahead of probe_hash() */
+static inline void prefetch_hash(uint64_t key)
+{
+    if (search_hash)
+        __builtin_prefetch(&search_hash[key & search_hash_mask]);
+}
+
+/* Returns the stored entry for the position with key, or NULL */
+static HashEntry* probe_hash(uint64_t key)
+{
+    if (!search_hash)
+        return NULL;
+    HashBucket* bucket = &search_hash[key & search_hash_mask];
+    hash_probes++;
+    if (bucket->deep.key == key && bucket->deep.depth)
+    {
+        hash_hits++;
+        return &bucket->deep;
+    }
+    if (bucket->recent.key == key && bucket->recent.depth)
+    {
+        hash_hits++;
+        return &bucket->recent;
+    }
+    return NULL;
+}
+
+/* Returns the score of entry for its position reached ply plies from the
+ * root. Mate scores are stored counted from the position itself, so they
+ * stay right wherever in the tree the position comes up again.
+ */
+static int hash_score(HashEntry* entry, int ply)
+{
+    if (entry->score >= MATE_BOUND)
+        return entry->score - ply;
+    if (entry->score <= -MATE_BOUND)
+        return entry->score + ply;
+    return entry->score;
+}
+
+/* Returns non-zero if entry settles the value of its position, ply plies
+ * from the root, for a search of depth with the window alpha to beta
+ */
+static int hash_cutoff(HashEntry* entry, int alpha, int beta, int depth,
+        int ply)
+{
+    int score = hash_score(entry, ply);
+    if (entry->depth < depth)
+        return 0;
+    if (entry->bound == BOUND_EXACT ||
+            (entry->bound == BOUND_LOWER && score >= beta) ||
+            (entry->bound == BOUND_UPPER && score <= alpha))
+    {
+        hash_cutoffs++;
+        return 1;
+    }
+    return 0;
+}
+
+/* Stores the result of searching the position with key, ply plies from the
+ * root, to depth. A position already in the bucket keeps its best move if
+ * the new search found none.
+ */
+static void store_hash(uint64_t key, PackedMove move, int score, int depth,
+        int bound, int ply)
+{
+    if (!search_hash)
+        return;
+    if (score >= MATE_BOUND)
+        score += ply;
+    else if (score <= -MATE_BOUND)
+        score -= ply;
+    HashBucket* bucket = &search_hash[key & search_hash_mask];
+    HashEntry* entry = &bucket->recent;
+    if (bucket->deep.key == key || depth >= bucket->deep.depth ||
+            bucket->deep.age != search_age)
+        entry = &bucket->deep;
+    if (move == NULL_MOVE && entry->key == key)
+        move = entry->move;
+    entry->key = key;
+    entry->move = move;
+    entry->score = score;
+    entry->depth = depth;
+    entry->bound = bound;
+    entry->age = search_age;
+}
+
+/* Starts a picker for the position ply plies from the root. hash_move must
+ * be legal and is tried first if it is not NULL_MOVE, then the killers
+ * stored for ply.
+ */
+void init_picker(MovePicker* picker, PackedMove hash_move, int ply)
+{
+    if (ply >= MAX_SEARCH_DEPTH)
+        ply = MAX_SEARCH_DEPTH - 1;
+    picker->stage = (hash_move != NULL_MOVE) ? PICK_HASH : PICK_GEN_CAPTURES;
+    picker->hash_move = hash_move;
+    picker->killers[0] = killers[ply][0];
+    picker->killers[1] = killers[ply][1];
+    picker->index = 0;
+    picker->count = 0;
+    picker->bad_count = 0;
+    picker->captures_only = 0;
+}
+
+/* Starts a picker that only hands out the captures and promotions of the
+ * position, leaving out captures that lose material by see()
+ */
+void init_capture_picker(MovePicker* picker)
+{
+    init_picker(picker, NULL_MOVE, 0);
+    picker->captures_only = 1;
+}
+
+/* Returns non-zero if move neither captures nor promotes */
+static int is_quiet_move(Board* board, PackedMove move)
+{
+    int src = MOVE_SRC(move);
+    int dest = MOVE_DEST(move);
+    return !board->position[dest] && !MOVE_PROMOTION(move) &&
+           !((board->position[src] & PAWN) && dest % 8 != src % 8);
+}
+
+/* Records a quiet move that caused a beta cutoff ply plies from the root */
+void store_killer(Board* board, PackedMove move, int ply)
+{
+    if (ply >= MAX_SEARCH_DEPTH)
+        ply = MAX_SEARCH_DEPTH - 1;
+    if (!is_quiet_move(board, move) || killers[ply][0] == move)
+        return;
+    killers[ply][1] = killers[ply][0];
+    killers[ply][0] = move;
+}
+
+/* Generates the captures and promotions, scoring them by most valuable
+ * victim and least valuable attacker. Captures of a defended piece of lower
+ * value than the capturer are put aside to be tried last, or left out by a
+ * capture picker when see() finds they lose material.
+ */
+static void gen_captures(Board* board, MovePicker* picker)
+{
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = generate_moves(board, moves, GEN_CAPTURES);
+    int i;
+    picker->count = 0;
+    for (i = 0; i < count; ++i)
+    {
+        int src = MOVE_SRC(moves[i]);
+        int dest = MOVE_DEST(moves[i]);
+        int victim = get_value(board, dest);
+        int attacker = get_value(board, src);
+        if (moves[i] == picker->hash_move)
+            continue;
+        if (!board->position[dest] && !MOVE_PROMOTION(moves[i]))
+            victim = get_value(board, src); /* En passant */
+        if (!MOVE_PROMOTION(moves[i]) && victim < attacker &&
+                is_attacked(board, dest))
         {
-            int choice = rand() % found_moves.num_found;
-            move.dest = start_square;
-            move.src_piece = board->position[found_moves.squares[choice]];
-            move.src_rank = found_moves.squares[choice] / 8;
-            move.src_file = found_moves.squares[choice] % 8;
+            if (picker->captures_only && see(board, moves[i]) < 0)
+                continue;
+            picker->bad_captures[picker->bad_count++] = moves[i];
+            continue;
         }
+        picker->moves[picker->count] = moves[i];
+        picker->scores[picker->count] = victim * 16 - attacker;
+        if (MOVE_PROMOTION(moves[i]))
+            picker->scores[picker->count] +=
+                get_piece_value(1 << MOVE_PROMOTION(moves[i])) * 16;
+        picker->count++;
     }
+    picker->index = 0;
+}
+
+/* Generates the quiet moves other than the hash move and killers, scoring
+ * moves to safe squares above the rest
+ */
+static void gen_quiets(Board* board, MovePicker* picker)
+{
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = generate_moves(board, moves, GEN_QUIETS);
+    int i;
+    picker->count = 0;
+    for (i = 0; i < count; ++i)
+    {
+        if (moves[i] == picker->hash_move || moves[i] == picker->killers[0] ||
+                moves[i] == picker->killers[1])
+            continue;
+        picker->moves[picker->count] = moves[i];
+        picker->scores[picker->count] = (is_safe_move(board,
+                    MOVE_DEST(moves[i]), MOVE_SRC(moves[i]))) ? 4 : 0;
+        picker->count++;
+    }
+    picker->index = 0;
+}
+
+/* Returns the highest scored move not handed out yet from the current stage
+ */
+static PackedMove pick_best(MovePicker* picker)
+{
+    int best = picker->index;
+    int i;
+    for (i = picker->index + 1; i < picker->count; ++i)
+        if (picker->scores[i] > picker->scores[best])
+            best = i;
+    PackedMove move = picker->moves[best];
+    int16_t score = picker->scores[best];
+    picker->moves[best] = picker->moves[picker->index];
+    picker->scores[best] = picker->scores[picker->index];
+    picker->moves[picker->index] = move;
+    picker->scores[picker->index] = score;
+    picker->index++;
     return move;
 }
 
+/* Returns the next move to search, or NULL_MOVE once every legal move has
+ * been handed out
+ */
+PackedMove next_move(Board* board, MovePicker* picker)
+{
+    switch (picker->stage)
+    {
+        case PICK_HASH:
+            picker->stage = PICK_GEN_CAPTURES;
+            return picker->hash_move;
+        case PICK_GEN_CAPTURES:
+            gen_captures(board, picker);
+            picker->stage = PICK_GOOD_CAPTURES;
+            /* fall through */
+        case PICK_GOOD_CAPTURES:
+            if (picker->index < picker->count)
+                return pick_best(picker);
+            picker->stage = PICK_KILLERS;
+            picker->index = 0;
+            if (picker->captures_only)
+            {
+                picker->stage = PICK_BAD_CAPTURES;
+                return next_move(board, picker);
+            }
+            /* fall through */
+        case PICK_KILLERS:
+            while (picker->index < 2)
+            {
+                PackedMove killer = picker->killers[picker->index++];
+                if (killer != picker->hash_move &&
+                        is_legal_quiet(board, killer))
+                    return killer;
+            }
+            picker->stage = PICK_GEN_QUIETS;
+            /* fall through */
+        case PICK_GEN_QUIETS:
+            gen_quiets(board, picker);
+            picker->stage = PICK_QUIETS;
+            /* fall through */
+        case PICK_QUIETS:
+            if (picker->index < picker->count)
+                return pick_best(picker);
+            picker->stage = PICK_BAD_CAPTURES;
+            picker->index = 0;
+            /* fall through */
+        case PICK_BAD_CAPTURES:
+            if (picker->index < picker->bad_count)
+                return picker->bad_captures[picker->index++];
+            picker->stage = PICK_DONE;
+    }
+    return NULL_MOVE;
+}
+
+/* Fills moves with the legal moves of type, leaving out promotions to
+ * anything but a queen, and returns how many there are
+ */
+int get_queening_moves(Board* board, PackedMove* moves, int type)
+{
+    int count = generate_moves(board, moves, type);
+    int kept = 0;
+    int i;
+    for (i = 0; i < count; ++i)
+    {
+        if (!MOVE_PROMOTION(moves[i]) ||
+                MOVE_PROMOTION(moves[i]) == TYPE_INDEX(QUEEN))
+            moves[kept++] = moves[i];
+    }
+    return kept;
+}
+
+/* Returns the index of the hanging piece of the side to move with the
+ * highest value, or -1 if every piece is safe
+ */
+int find_hanging(Board* board)
+{
+    uint64_t pieces = board->occupied[board->to_move != 0];
+    int hanging = -1;
+    while (pieces)
+    {
+        int i = pop_lsb(&pieces);
+        if (!is_safe(board, i) &&
+                get_value(board, i) > get_value(board, hanging))
+            hanging = i;
+    }
+    return hanging;
+}
+
+/* Returns non-zero if moving src to dest leaves hanging safe, or if there is
+ * no hanging piece
+ */
+int saves_hanging(Board* board, int dest, int src, int hanging)
+{
+    if (hanging == -1 || hanging == src)
+        return 1;
+    return will_protect(board, dest, src, hanging);
+}
+
+/* Returns a random legal move */
+Move Erandom_move(Board* board)
+{
+    print_debug("Playing Random Move\n");
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = generate_moves(board, moves, GEN_ALL);
+    if (!count)
+        return default_move;
+    return unpack_move(board, moves[rand() % count]);
+}
+
 /* Returns a random move that will take an enemy piece */
 Move Eaggressive_move(Board* board)
 {
     print_debug("Playing Aggressive Move\n");
-    Move move = default_move;
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = get_queening_moves(board, moves, GEN_CAPTURES);
+    int start = (count) ? rand() % count : 0;
     int i;
-    uint8_t pieces = ALL_PIECES;
-    uint8_t opp_color = (board->to_move) ? WHITE : BLACK;
-    move.promotion |= (board->to_move) ? BLACK : WHITE;
-    pieces |= (board->to_move) ? BLACK : WHITE;
-    int start_square = rand() % 64;
-    for (i = 0; i < 64; ++i)
-    {
-        int curr_square = (start_square + i) % 64;
-        if (board->position[curr_square] && 
-                (board->position[curr_square] & 0x80) == opp_color)
-        {
-            Found found_moves;
-            find_attacker(board, curr_square, pieces, &found_moves);
-            if (found_moves.num_found)
-            {
-                int choice = rand() % found_moves.num_found;
-                move.dest = curr_square;
-                move.src_piece = board->position[found_moves.squares [choice]];
-                move.src_rank = found_moves.squares[choice] / 8;
-                move.src_file = found_moves.squares[choice] % 8;
-                break;
-            }
-        }
+    for (i = 0; i < count; ++i)
+    {
+        PackedMove move = moves[(start + i) % count];
+        if (board->position[MOVE_DEST(move)])
+            return unpack_move(board, move);
     }
-    if (move.dest == -1)
-        return Erandom_move(board);
-    else
-        return move;
+    return Erandom_move(board);
 }
 
 /* Returns a move that will put the enemy king in check */
 Move Eape_move(Board* board)
 {
     print_debug("Playing Ape Move\n");
-    Move move = default_move;
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = get_queening_moves(board, moves, GEN_ALL);
+    int start = (count) ? rand() % count : 0;
     int i;
-    uint8_t pieces = ALL_PIECES;
-    pieces |= (board->to_move) ? BLACK : WHITE;
-    move.promotion |= (board->to_move) ? BLACK : WHITE;
-    int start_square = rand() % 64;
-    for (i = 0; i < 64; ++i)
-    {
-        int curr_square = (start_square + i) % 64;
-        Found found_moves;
-        find_attacker(board, curr_square, pieces, &found_moves);
-        int j;
-        for (j = 0; j < found_moves.num_found; ++j)
-            if (gives_check(board, curr_square, found_moves.squares[j]))
-            {
-                move.dest = curr_square;
-                move.src_piece = board->position[found_moves.squares[j]];
-                move.src_rank = found_moves.squares[j] / 8;
-                move.src_file = found_moves.squares[j] % 8;
-                break;
-            }
+    for (i = 0; i < count; ++i)
+    {
+        PackedMove move = moves[(start + i) % count];
+        if (gives_check(board, MOVE_DEST(move), MOVE_SRC(move)))
+            return unpack_move(board, move);
     }
-    if (move.dest == -1)
-        return Eaggressive_move(board);
-    else
-        return move;
+    return Eaggressive_move(board);
 }
 
 /* Returns a random safe move */
@@ -289,70 +818,39 @@ Move Esafe(Board* board, int protecc)
         print_debug("Protecc Playing safe Move\n");
     else
         print_debug("Playing safe Move\n");
-    Move move = default_move;
+    int hanging = (protecc) ? find_hanging(board) : -1;
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = get_queening_moves(board, moves, GEN_ALL);
+    int start = (count) ? rand() % count : 0;
     int i;
-    uint8_t pieces = ALL_PIECES;
-    pieces |= (board->to_move) ? BLACK : WHITE;
-    move.promotion |= (board->to_move) ? BLACK : WHITE;
-    uint8_t color = pieces & 0x80;
-    int start_square = rand() % 64;
-    int hanging = -1;
-    if (protecc)
+    for (i = 0; i < count; ++i)
     {
-        for (i = 0; i < 64; ++i)
+        PackedMove move = moves[(start + i) % count];
+        int dest = MOVE_DEST(move);
+        int target = MOVE_SRC(move);
+        if (is_safe_move(board, dest, target))
         {
-            if (board->position[i] && (board->position[i] & 0x80) == color &&
-                                      !is_safe(board, i))
-                if (get_value(board, i) > get_value(board, hanging))
-                    hanging = i;
-        }
-    }
-    for (i = 0; i < 128; ++i)
-    {
-        int curr_square = (rand() % 64 + i) % 64;
-        Found found_moves;
-        find_attacker(board, curr_square, pieces, &found_moves);
-        int j;
-        for (j = 0; j < found_moves.num_found; ++j)
-        {
-            int target = found_moves.squares[j];
-            if (is_safe_move(board, curr_square, target))
+            if (hanging != -1)
             {
-                if (hanging != -1)
-                {
-                    print_debug("Will %c%d  to %c%d save %c%d? ",
-                            target%8+'a',8-target/8,
-                            curr_square%8+'a',8-curr_square/8,
-                            hanging%8+'a',8-hanging/8);
-                    int found = 0;
-                    if (hanging == target)
-                        found = 1;
-                    else if (will_protect(board, curr_square, target, hanging))
-                        found = 1;
-                    if (found)
-                        print_debug("Yes.\n");
-                    else
-                        print_debug("No.\n");
-                    if (!found)
-                        continue;
-                }
-                move.dest = curr_square;
-                move.src_piece = board->position[target];
-                move.src_rank = target / 8;
-                move.src_file = target % 8;
-                break;
+                print_debug("Will %c%d  to %c%d save %c%d? ",
+                        target%8+'a',8-target/8,
+                        dest%8+'a',8-dest/8,
+                        hanging%8+'a',8-hanging/8);
+                int found = saves_hanging(board, dest, target, hanging);
+                if (found)
+                    print_debug("Yes.\n");
+                else
+                    print_debug("No.\n");
+                if (!found)
+                    continue;
             }
+            return unpack_move(board, move);
         }
     }
-    if (move.dest == -1)
-    {
-        if (protecc)
-            return Eideal(board, 0);
-        else
-            return Eape_move(board);
-    }
+    if (protecc)
+        return Eideal(board, 0);
     else
-        return move;
+        return Eape_move(board);
 }
 
 /* Returns a random move that simultaneously takes a piece, and is safe */
@@ -362,71 +860,27 @@ Move Esafeaggro(Board* board, int protecc)
         print_debug("Protecc Playing safeaggro Move\n");
     else
         print_debug("Playing safeaggro Move\n");
-    Move move = default_move;
+    int hanging = (protecc) ? find_hanging(board) : -1;
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = get_queening_moves(board, moves, GEN_CAPTURES);
+    int start = (count) ? rand() % count : 0;
     int i;
-    uint8_t pieces = ALL_PIECES;
-    uint8_t opp_color = (board->to_move) ? WHITE : BLACK;
-    pieces |= (board->to_move) ? BLACK : WHITE;
-    move.promotion |= (board->to_move) ? BLACK : WHITE;
-    uint8_t color = pieces & 0x80;
-    int start_square = rand() % 64;
-    int hanging = -1;
-    if (protecc)
-    {
-        for (i = 0; i < 64; ++i)
-        {
-            if (board->position[i] && (board->position[i] & 0x80) == color &&
-                    !is_safe(board, i))
-                if (get_value(board, i) > get_value(board, hanging))
-                    hanging = i;
-        }
-    }
-    for (i = 0; i < 128; ++i)
-    {
-        int curr_square = (rand() % 64 + i) % 64;
-        if (board->position[curr_square] &&
-                (board->position[curr_square] & 0x80) == opp_color)
-        {
-            Found found_moves;
-            find_attacker(board, curr_square, pieces, &found_moves);
-            int j;
-            for (j = 0; j < found_moves.num_found; ++j)
-            {
-                int target = found_moves.squares[j];
-                if (is_safe_move(board, curr_square, target) ||
-                        get_value(board, curr_square) > get_value(board,
-                            target))
-                {
-                if (hanging != -1)
-                {
-                    int found = 0;
-                    if (hanging == target)
-                        found = 1;
-                    else if (will_protect(board, curr_square, target, hanging))
-                        found = 1;
-                    if (!found)
-                        continue;
-                }
-                    move.dest = curr_square;
-                    move.src_piece = board->position[target];
-                    move.src_rank = target / 8;
-                    move.src_file = target % 8;
-                    break;
-                }
-            }
-        }
-        if (move.dest != -1)
-            break;
-    }
-    if (move.dest == -1)
+    for (i = 0; i < count; ++i)
     {
-        if (protecc)
-            return Esafe(board, 1);
-        else
-            return Esafe(board, 0);
+        PackedMove move = moves[(start + i) % count];
+        int dest = MOVE_DEST(move);
+        int target = MOVE_SRC(move);
+        if (!board->position[dest])
+            continue;
+        if ((is_safe_move(board, dest, target) ||
+                    get_value(board, dest) > get_value(board, target)) &&
+                saves_hanging(board, dest, target, hanging))
+            return unpack_move(board, move);
     }
+    if (protecc)
+        return Esafe(board, 1);
     else
-        return move;
+        return Esafe(board, 0);
 }
 
 /* Returns a random move that simultanously puts the enemy king in check, while
@@ -438,68 +892,26 @@ Move Enohang(Board* board, int protecc)
         print_debug("Protecc Playing nohang Move\n");
     else
         print_debug("Playing nohang Move\n");
-    Move move = default_move;
+    int hanging = (protecc) ? find_hanging(board) : -1;
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = get_queening_moves(board, moves, GEN_ALL);
+    int start = (count) ? rand() % count : 0;
     int i;
-    uint8_t pieces = ALL_PIECES;
-    pieces |= (board->to_move) ? BLACK : WHITE;
-    move.promotion |= (board->to_move) ? BLACK : WHITE;
-    uint8_t color = pieces & 0x80;
-    int hanging = -1;
-    if (protecc)
-    {
-        for (i = 0; i < 64; ++i)
-        {
-            if (board->position[i] && (board->position[i] & 0x80) == color &&
-                    !is_safe(board, i))
-                if (get_value(board, i) > get_value(board, hanging))
-                    hanging = i;
-        }
-    }
-    int start_square = rand() % 64;
-    for (i = 0; i < 128; ++i)
-    {
-        int curr_square = (rand() % 64 + i) % 64;
-        Found found_moves;
-        find_attacker(board, curr_square, pieces, &found_moves);
-        int j;
-        for (j = 0; j < found_moves.num_found; ++j)
-        {
-            int target = found_moves.squares[j];
-            if (gives_check(board, curr_square, found_moves.squares[j]) && 
-                     (is_safe_move(board, curr_square, target) ||
-                      get_value(board, curr_square) > get_value(board, target)))
-            {
-                if (hanging != -1)
-                {
-                    int found = 0;
-                    if (hanging == target)
-                        found = 1;
-                    else if (will_protect(board, curr_square, target, hanging))
-                        found = 1;
-                    if (!found)
-                        continue;
-                }
-                move.dest = curr_square;
-                move.src_piece = board->position[target];
-                move.src_rank = target / 8;
-                move.src_file = target % 8;
-                break;
-            }
-        }
-        if (move.dest != -1)
-            break;
-    }
-    if (move.dest == -1)
+    for (i = 0; i < count; ++i)
     {
-        if (protecc)
-            return Esafeaggro(board, 1);
-        else
-            return Esafeaggro(board, 0);
+        PackedMove move = moves[(start + i) % count];
+        int dest = MOVE_DEST(move);
+        int target = MOVE_SRC(move);
+        if (gives_check(board, dest, target) && 
+                 (is_safe_move(board, dest, target) ||
+                  get_value(board, dest) > get_value(board, target)) &&
+                saves_hanging(board, dest, target, hanging))
+            return unpack_move(board, move);
     }
+    if (protecc)
+        return Esafeaggro(board, 1);
     else
-    {
-        return move;
-    }
+        return Esafeaggro(board, 0);
 }
 
 /* Returns a move that is safe, takes a piece, and puts the enemy king in check
@@ -510,247 +922,525 @@ Move Eideal(Board* board, int protecc)
         print_debug("Protecc Playing ideal Move\n");
     else
         print_debug("Playing ideal Move\n");
-    Move move = default_move;
+    int hanging = (protecc) ? find_hanging(board) : -1;
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = get_queening_moves(board, moves, GEN_CAPTURES);
+    int start = (count) ? rand() % count : 0;
     int i;
-    uint8_t pieces = ALL_PIECES;
-    uint8_t opp_color = (board->to_move) ? WHITE : BLACK;
-    pieces |= (board->to_move) ? BLACK : WHITE;
-    move.promotion |= (board->to_move) ? BLACK : WHITE;
-    uint8_t color = pieces & 0x80;
-    int hanging = -1;
-    if (protecc)
-    {
-        for (i = 0; i < 64; ++i)
-        {
-            if (board->position[i] && (board->position[i] & 0x80) == color &&
-                    !is_safe(board, i))
-                if (get_value(board, i) > get_value(board, hanging))
-                    hanging = i;
-        }
-    }
-    for (i = 0; i < 128; ++i)
-    {
-        int curr_square = (rand() % 64 + i) % 64;
-        if (board->position[curr_square] && 
-                (board->position[curr_square] & 0x80) == opp_color)
-        {
-            Found found_moves;
-            find_attacker(board, curr_square, pieces, &found_moves);
-            int j;
-            for (j = 0; j < found_moves.num_found; ++j)
-            {
-                int target = found_moves.squares[j];
-                if (gives_check(board, curr_square, found_moves.squares[j]) &&
-                        (is_safe_move(board, curr_square, target) ||
-                         get_value(board, curr_square) > get_value(board,
-                             target)))
-                {
-                if (hanging != -1)
-                {
-                    int found = 0;
-                    if (hanging == target)
-                        found = 1;
-                    else if (will_protect(board, curr_square, target, hanging))
-                        found = 1;
-                    if (!found)
-                        continue;
-                }
-                    move.dest = curr_square;
-                    move.src_piece = board->position[target];
-                    move.src_rank = target / 8;
-                    move.src_file = target % 8;
-                    break;
-                }
-            }
-        }
-        if (move.dest != -1)
-            break;
-    }
-    if (move.dest == -1)
+    for (i = 0; i < count; ++i)
     {
-        if (protecc)
-            return Enohang(board, 1);
-        else
-            return Enohang(board, 0);
+        PackedMove move = moves[(start + i) % count];
+        int dest = MOVE_DEST(move);
+        int target = MOVE_SRC(move);
+        if (!board->position[dest])
+            continue;
+        if (gives_check(board, dest, target) &&
+                (is_safe_move(board, dest, target) ||
+                 get_value(board, dest) > get_value(board, target)) &&
+                saves_hanging(board, dest, target, hanging))
+            return unpack_move(board, move);
     }
+    if (protecc)
+        return Enohang(board, 1);
     else
-        return move;
+        return Enohang(board, 0);
 }
 
 /* Returns a move that will put the king in checkmate */
 Move Emateinone(Board* board)
 {
     print_debug("Playing mateinone Move\n");
-    Move move = default_move;
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = get_queening_moves(board, moves, GEN_ALL);
     int i;
-    uint8_t pieces = ALL_PIECES;
-    uint8_t opp_color = (board->to_move) ? WHITE : BLACK;
-    pieces |= (board->to_move) ? BLACK : WHITE;
-    move.promotion |= (board->to_move) ? BLACK : WHITE;
-    for (i = 0; i < 64; ++i)
-    {
-        Found found_moves;
-        find_attacker(board, i, pieces, &found_moves);
-        int j;
-        for (j = 0; j < found_moves.num_found; ++j)
-        {
-            int m = found_moves.squares[j];
-            if (gives_checkmate(board, i, found_moves.squares[j]))
-            {
-                move.dest = i;
-                move.src_piece = board->position[found_moves.squares[j]];
-                move.src_rank = found_moves.squares[j] / 8;
-                move.src_file = found_moves.squares[j] % 8;
-                break;
-            }
-        }
-        if (move.dest != -1)
-            break;
+    for (i = 0; i < count; ++i)
+    {
+        if (gives_checkmate(board, MOVE_DEST(moves[i]), MOVE_SRC(moves[i])))
+            return unpack_move(board, moves[i]);
     }
-    if (move.dest == -1)
-        return Eideal(board, 1);
-    else
-        return move;
+    return Eideal(board, 1);
 }
 
 int evaluate_move(Board* board, Candidate can, int depth)
 {
-    Board temp_board;
-    memcpy(&temp_board, board, sizeof(Board));
-    int black_score[6];
-    int white_score[6];
+    Undo undo;
     int old_score = 0;
-    get_material_scores(&temp_board, white_score, black_score);
-    if (!temp_board.to_move)
-        old_score = white_score[0] - black_score[0];
+    int result;
+    if (!board->to_move)
+        old_score = board->material[0] - board->material[1];
+    else
+        old_score = board->material[1] - board->material[0];
+    make_packed_move(board, can.move, &undo);
+    if (board->to_move)
+        result = board->material[0] - board->material[1] - old_score;
     else
-        old_score = black_score[0] - white_score[0];
-    move_piece(&temp_board, &can.move);
-    get_material_scores(&temp_board, white_score, black_score);
-    int board_value = 200;
+        result = board->material[1] - board->material[0] - old_score;
     if (depth > 0)
     {
+        int board_value = 200;
         Candidate cans[MOVES_PER_POSITION];
-        get_all_moves(&temp_board, cans);
+        int count = get_all_moves(board, cans);
         int i;
         int temp;
-        for (i = 0; i < MOVES_PER_POSITION; ++i)
+        for (i = 0; i < count; ++i)
         {
-            if (cans[i].weight <= 0)
-                continue;
-            temp = -1 * evaluate_move(&temp_board, cans[i], depth - 1);
+            temp = -1 * evaluate_move(board, cans[i], depth - 1);
             if (temp < board_value)
                 board_value = temp;
         }
-
-        //return board_value;
-        if (temp_board.to_move)
-            return white_score[0] - black_score[0] - old_score + board_value;
-        else
-            return black_score[0] - white_score[0] - old_score + board_value;
+        result += board_value;
     }
+    unmake_move(board, &undo);
+    return result;
+}
+
+/* Makes move the first move of the principal variation at ply, followed by
+ * the line found below it
+ */
+static void update_pv(int ply, PackedMove move)
+{
+    int i;
+    pv_table[ply][ply] = move;
+    for (i = ply + 1; i < pv_length[ply + 1]; ++i)
+        pv_table[ply][i] = pv_table[ply + 1][i];
+    pv_length[ply] = (pv_length[ply + 1] > ply + 1) ? pv_length[ply + 1]
+                                                    : ply + 1;
+}
+
+/* Turns one of the PRUNE_ features of the search on or off, so they can be
+ * compared against each other
+ */
+void set_search_pruning(int feature, int on)
+{
+    if (on)
+        search_pruning |= feature;
+    else
+        search_pruning &= ~feature;
+}
+
+/* Returns non-zero if the side to move is in check. Unlike is_attacked() it
+ * does not need the attack map of the position.
+ */
+static int side_in_check(Board* board)
+{
+    int us = board->to_move != 0;
+    int king = (us) ? board->bking_pos : board->wking_pos;
+    uint64_t occupied = board->occupied[0] | board->occupied[1];
+    return (attackers_to(board, king, occupied) & board->occupied[!us]) != 0;
+}
+
+/* Returns non-zero if the side to move has a piece other than pawns and its
+ * king. Without one, passing is often better than any move (zugzwang), and
+ * null move pruning would be unsound.
+ */
+static int has_pieces(Board* board)
+{
+    int us = board->to_move != 0;
+    return (board->occupied[us] & ~board->pieces[TYPE_INDEX(PAWN)]
+            & ~board->pieces[TYPE_INDEX(KING)]) != 0;
+}
+
+/* Returns how many plies to take off the search of a late quiet move. Moves
+ * further down the order and deeper searches are reduced more.
+ */
+static int lmr_reduction(int depth, int moves)
+{
+    int reduction = 1;
+    if (moves > 2 * LMR_MOVES)
+        reduction++;
+    if (depth >= 6)
+        reduction++;
+    if (reduction > depth - 2)
+        reduction = depth - 2;
+    return reduction;
+}
+
+/* Returns the value of the position for the side to move once its captures
+ * have played out, so the search never stops halfway through an exchange.
+ * Out of check the side to move may stand pat on its material rather than
+ * capture. Only captures that do not lose material by see() are tried, most
+ * valuable victim first, and captures that could not bring the material
+ * back up to alpha are skipped (delta pruning). In check every evasion is
+ * searched.
+ */
+static int quiescence(Board* board, int alpha, int beta, int ply)
+{
+    int us = board->to_move != 0;
+    int stand_pat = board->material[us] - board->material[!us];
+    int in_check = side_in_check(board);
+    int best = -MATE_SCORE + ply;
+    MovePicker picker;
+    Undo undo;
+    PackedMove next;
+    quiescence_nodes++;
+    if (insufficient_material(board))
+        return 0;
+    if (ply >= MAX_SEARCH_DEPTH)
+        return stand_pat;
+    if (in_check)
+        init_picker(&picker, NULL_MOVE, ply);
     else
     {
-        if (temp_board.to_move)
-            return white_score[0] - black_score[0] - old_score;
-        else
-            return black_score[0] - white_score[0] - old_score;
+        if (stand_pat >= beta)
+            return stand_pat;
+        if (stand_pat > alpha)
+            alpha = stand_pat;
+        best = stand_pat;
+        init_capture_picker(&picker);
     }
+    while ((next = next_move(board, &picker)) != NULL_MOVE)
+    {
+        int score;
+        if (!in_check && !MOVE_PROMOTION(next))
+        {
+            int victim = get_value(board, MOVE_DEST(next));
+            if (!victim)
+                victim = get_piece_value(PAWN); /* En passant */
+            if (stand_pat + victim + DELTA_MARGIN <= alpha)
+                continue;
+        }
+        make_packed_move(board, next, &undo);
+        score = -quiescence(board, -beta, -alpha, ply + 1);
+        unmake_move(board, &undo);
+        if (score > best)
+            best = score;
+        if (score > alpha)
+            alpha = score;
+        if (alpha >= beta)
+            break;
+    }
+    return best;
 }
 
-int eval_prune(Board* board, Candidate can, int alpha, int beta, int depth)
+/* Returns the negamax value of the position for the side to move, searched
+ * depth plies deep with principal variation search. The position is ply
+ * plies from the root. The first move gets the whole alpha to beta window
+ * and is expected to be the best with good ordering, so the rest are only
+ * searched with a null window to prove they are no better. A move that
+ * proves better is searched again with the whole window.
+ * Moves come from a MovePicker, so a cutoff skips generating the later
+ * stages. While the moves played so far follow the last iteration's
+ * principal variation, its next move is tried first. Otherwise positions
+ * searched before are looked up in the search hash, which can settle their
+ * value or give the move to try first. Past depth the position is left to
+ * quiescence().
+ *
+ * Outside the principal variation and out of check the search is
+ * selective. Close to the leaves a position far enough above beta is taken
+ * at its material (reverse futility), and quiet moves that can not bring
+ * the material back up to alpha are skipped (futility). Elsewhere the side
+ * to move passes, and if a shallower search still reaches beta the position
+ * is cut off (null move). Late quiet moves are searched shallower first,
+ * and only searched fully if they beat alpha (late move reductions).
+ */
+int eval_prune(Board* board, int alpha, int beta, int depth, int ply)
 {
-    Board temp_board;
-    memcpy(&temp_board, board, sizeof(Board));
-    move_piece(&temp_board, &can.move);
-    if (check_stalemate(board, temp_board.to_move))
-        return 0;
+    int us = board->to_move != 0;
+    HashEntry* entry = NULL;
+    pv_length[ply] = ply;
     if (depth == 0)
+        return quiescence(board, alpha, beta, ply);
+    search_nodes++;
+    entry = probe_hash(board->hash);
+    if (!on_last_pv[ply] && entry &&
+            hash_cutoff(entry, alpha, beta, depth, ply))
+        return hash_score(entry, ply);
+
+    MovePicker picker;
+    Undo undo;
+    PackedMove next;
+    PackedMove hash_move = NULL_MOVE;
+    PackedMove best_move = NULL_MOVE;
+    int old_alpha = alpha;
+    int best = -MATE_SCORE;
+    int moves = 0;
+    int in_check = side_in_check(board);
+    int material = board->material[us] - board->material[!us];
+    int selective = !in_check && beta - alpha == 1;
+    int futile = 0;
+
+    if (selective && (search_pruning & PRUNE_FUTILITY) &&
+            depth <= FUTILITY_DEPTH)
+    {
+        if (material - FUTILITY_MARGIN * depth >= beta)
+            return material - FUTILITY_MARGIN * depth;
+        futile = material + FUTILITY_MARGIN * depth <= alpha;
+    }
+
+    if (selective && (search_pruning & PRUNE_NULL_MOVE) && !after_null[ply] &&
+            depth >= NULL_MOVE_DEPTH && material >= beta && has_pieces(board))
+    {
+        int reduction = (depth >= NULL_VERIFY_DEPTH) ? 3 : 2;
+        int score;
+        make_null_move(board, &undo);
+        prefetch_hash(board->hash);
+        after_null[ply + 1] = 1;
+        on_last_pv[ply + 1] = 0;
+        score = -eval_prune(board, -beta, -beta + 1,
+                (depth - 1 > reduction) ? depth - 1 - reduction : 0,
+                ply + 1);
+        after_null[ply + 1] = 0;
+        unmake_null_move(board, &undo);
+        /* Deep cutoffs are checked with a shallower normal search of the
+         * position, in case it is a zugzwang the material guard missed
+         */
+        if (score >= beta && depth >= NULL_VERIFY_DEPTH)
+        {
+            after_null[ply] = 1;
+            score = eval_prune(board, beta - 1, beta, depth - reduction, ply);
+            after_null[ply] = 0;
+        }
+        if (score >= beta)
+            return (score >= MATE_BOUND) ? beta : score;
+    }
+
+    if (on_last_pv[ply] && ply < last_pv_length &&
+            is_legal_move(board, last_pv[ply]))
+        hash_move = last_pv[ply];
+    else if (entry && is_legal_move(board, entry->move))
+        hash_move = entry->move;
+    init_picker(&picker, hash_move, ply);
+    while ((next = next_move(board, &picker)) != NULL_MOVE)
     {
-        int black_score[6];
-        int white_score[6];
-        get_material_scores(&temp_board, white_score, black_score);
-        return white_score[0] - black_score[0];
+        int score;
+        int quiet = is_quiet_move(board, next);
+        on_last_pv[ply + 1] = on_last_pv[ply] && ply < last_pv_length &&
+                              last_pv[ply] == next;
+        make_packed_move(board, next, &undo);
+        /* The child probes the hash unless it is a quiescence search, and
+         * the check test and futility work below hide the load
+         */
+        if (depth > 1)
+            prefetch_hash(board->hash);
+        int gives_check = side_in_check(board);
+        if (futile && moves && quiet && !gives_check)
+        {
+            unmake_move(board, &undo);
+            moves++;
+            if (material + FUTILITY_MARGIN * depth > best)
+                best = material + FUTILITY_MARGIN * depth;
+            continue;
+        }
+        if (!moves++)
+            score = -eval_prune(board, -beta, -alpha, depth - 1, ply + 1);
+        else
+        {
+            int reduction = 0;
+            if (selective && (search_pruning & PRUNE_LMR) &&
+                    depth >= LMR_DEPTH && moves > LMR_MOVES && quiet &&
+                    !gives_check && picker.stage == PICK_QUIETS)
+                reduction = lmr_reduction(depth, moves);
+            score = -eval_prune(board, -alpha - 1, -alpha,
+                    depth - 1 - reduction, ply + 1);
+            if (reduction && score > alpha)
+                score = -eval_prune(board, -alpha - 1, -alpha, depth - 1,
+                        ply + 1);
+            if (score > alpha && score < beta)
+                score = -eval_prune(board, -beta, -alpha, depth - 1, ply + 1);
+        }
+        unmake_move(board, &undo);
+        if (score > best)
+        {
+            best = score;
+            best_move = next;
+        }
+        if (score > alpha)
+        {
+            alpha = score;
+            update_pv(ply, next);
+        }
+        if (alpha >= beta)
+        {
+            store_killer(board, next, ply);
+            break;
+        }
     }
+    if (!moves)
+        best = (in_check) ? -MATE_SCORE + ply : 0;
+    if (best <= old_alpha)
+        store_hash(board->hash, NULL_MOVE, best, depth, BOUND_UPPER, ply);
+    else if (best >= beta)
+        store_hash(board->hash, best_move, best, depth, BOUND_LOWER, ply);
     else
+        store_hash(board->hash, best_move, best, depth, BOUND_EXACT, ply);
+    return best;
+}
+
+/* Searches every root move depth plies past the move, within the window
+ * alpha to beta from the point of view of the side to move, and returns the
+ * best score found. Like eval_prune() only the first move gets the whole
+ * window. The best move is moved to the front of cans and its line left in
+ * the root principal variation.
+ */
+static int search_root(Board* board, Candidate* cans, int count, int alpha,
+        int beta, int depth)
+{
+    int best = -MATE_SCORE - 1;
+    int best_index = 0;
+    int i;
+    pv_length[0] = 0;
+    on_last_pv[0] = 1;
+    for (i = 0; i < count; ++i)
     {
-        Candidate cans[MOVES_PER_POSITION];
-        get_all_moves(&temp_board, cans);
-        int i;
-        int board_value;
-        int temp = 0;
-        if (temp_board.to_move)
-            board_value = 300;
+        Undo undo;
+        int score;
+        on_last_pv[1] = last_pv_length && last_pv[0] == cans[i].move;
+        make_packed_move(board, cans[i].move, &undo);
+        prefetch_hash(board->hash);
+        if (!i)
+            score = -eval_prune(board, -beta, -alpha, depth, 1);
         else
-            board_value = -300;
-        for (i = 0; i < MOVES_PER_POSITION; ++i)
         {
-            if (cans[i].weight <= 0)
-                break;
-            if (temp_board.to_move)
-            {
-                temp = eval_prune(&temp_board, cans[i], alpha, beta, depth - 1);
-                if (temp < board_value)
-                    board_value = temp;
-                beta = (temp < beta) ? temp : beta;
-                if (beta <= alpha)
-                    break;
-            }
-            else
-            {
-                temp = eval_prune(&temp_board, cans[i], alpha, beta, depth - 1);
-                if (temp > board_value)
-                    board_value = temp;
-                alpha = (temp > alpha) ? temp : alpha;
-                if (beta <= alpha)
-                   break;
-            }
+            score = -eval_prune(board, -alpha - 1, -alpha, depth, 1);
+            if (score > alpha && score < beta)
+                score = -eval_prune(board, -beta, -alpha, depth, 1);
         }
-        return board_value;
+        unmake_move(board, &undo);
+        if (score > best)
+        {
+            best = score;
+            best_index = i;
+        }
+        if (score > alpha)
+        {
+            alpha = score;
+            update_pv(0, cans[i].move);
+        }
+        if (alpha >= beta)
+            break;
     }
+    Candidate found = cans[best_index];
+    for (i = best_index; i > 0; --i)
+        cans[i] = cans[i - 1];
+    cans[0] = found;
+    cans[0].weight = best;
+    return best;
 }
 
-Move Econdensed(Board* board, int depth)
+/* Prints the score, node counts and principal variation of an iteration */
+static void print_iteration(int depth, int score, int searches)
 {
-    Board temp_board;
-    memcpy(&temp_board, board, sizeof(Board));
-    Candidate cans[MOVES_PER_POSITION];
-    get_all_moves(board, cans);
     int i;
-    Candidate best = cans[0];
-    //print_fancy(board);
+    printf("Depth %d: score %d, %lu nodes, %lu quiescence nodes, %d %s, pv",
+            depth, score, (unsigned long)search_nodes,
+            (unsigned long)quiescence_nodes, searches,
+            (searches == 1) ? "search" : "searches");
+    for (i = 0; i < last_pv_length; ++i)
+    {
+        printf(" ");
+        print_move(last_pv[i]);
+    }
+    printf("\n");
+}
+
+/* Returns the best move found by searching depth plies past each root move.
+ * Each iteration of the search goes one ply deeper than the last, starting
+ * with the last best move and following the last principal variation
+ * first. Iterations after the first search a narrow window around the last
+ * score, widening it and searching again whenever the score falls outside.
+ * If verbose is non-zero each iteration and the hash statistics are printed.
+ */
+Move Econdensed(Board* board, int depth, int verbose)
+{
+    Candidate cans[MOVES_PER_POSITION];
+    int count = get_all_moves(board, cans);
+    int score = 0;
     int j;
+    if (!count)
+        return default_move;
+    if (depth > MAX_SEARCH_DEPTH - 1)
+        depth = MAX_SEARCH_DEPTH - 1;
+    memset(killers, 0, sizeof(killers));
+    if (!search_hash && search_hash_megabytes)
+        set_search_hash(search_hash_megabytes);
+    search_age++;
+    hash_probes = 0;
+    hash_hits = 0;
+    hash_cutoffs = 0;
+    search_nodes = 0;
+    quiescence_nodes = 0;
+    last_pv_length = 0;
     for (j = 1; j <= depth; ++j)
     {
-        for (i = 0; i < 10; ++i)
+        int low_delta = ASPIRATION_WINDOW;
+        int high_delta = ASPIRATION_WINDOW;
+        int alpha = -MATE_SCORE;
+        int beta = MATE_SCORE;
+        int searches = 1;
+        if (j > 1)
         {
-            if (cans[i].weight <= 0)
-                break;
-            /*printf("BEFORE: Cand %c%d to %c%d",cans[i].move.src_file + 'a', 
-              8 - cans[i].move.src_rank,
-              cans[i].move.dest%8+'a',8-cans[i].move.dest/8);
-              printf(" with weight: %d\n", cans[i].weight);
-              */
-            int new_weight = eval_prune(board, cans[i], -300, 300, j);
-            if (board->to_move)
-                new_weight *= -1;
-            cans[i].weight += new_weight;
-            if (j == depth)
+            alpha = (score - low_delta > -MATE_SCORE) ? score - low_delta
+                                                      : -MATE_SCORE;
+            beta = (score + high_delta < MATE_SCORE) ? score + high_delta
+                                                     : MATE_SCORE;
+        }
+        score = search_root(board, cans, count, alpha, beta, j);
+        while ((score <= alpha && alpha > -MATE_SCORE) ||
+                (score >= beta && beta < MATE_SCORE))
+        {
+            if (score <= alpha)
+            {
+                low_delta *= 2;
+                alpha = (score - low_delta > -MATE_SCORE) ? score - low_delta
+                                                          : -MATE_SCORE;
+            }
+            else
             {
-                printf("Cand %c%d to %c%d",cans[i].move.src_file + 'a', 
-                        8 - cans[i].move.src_rank,
-                        cans[i].move.dest%8+'a',8-cans[i].move.dest/8);
-                printf(" with weight: %d\n", cans[i].weight);
+                high_delta *= 2;
+                beta = (score + high_delta < MATE_SCORE) ? score + high_delta
+                                                         : MATE_SCORE;
             }
-            if (cans[i].weight > best.weight)
-                best = cans[i];
+            score = search_root(board, cans, count, alpha, beta, j);
+            searches++;
         }
-        qsort(cans, MOVES_PER_POSITION, sizeof(Candidate), comp_cand);
+        memcpy(last_pv, pv_table[0], sizeof(last_pv));
+        last_pv_length = pv_length[0];
+        if (verbose)
+            print_iteration(j, score, searches);
     }
-    for (i = 0; i < MOVES_PER_POSITION; ++i)
-        if (cans[i].weight != best.weight)
-            break;
-    if (i - 1 > 0)
-        best = cans[rand() % (i - 1)];
-    return best.move;
+    if (verbose && search_hash)
+        printf("Hash: %lu hits of %lu probes (%.1f%%), %lu cutoffs\n",
+                (unsigned long)hash_hits, (unsigned long)hash_probes,
+                (hash_probes) ? 100.0 * hash_hits / hash_probes : 0.0,
+                (unsigned long)hash_cutoffs);
+    return unpack_move(board, cans[0].move);
+}
+
+/* Returns the wall clock time in seconds */
+static double now()
+{
+    struct timeval time;
+    gettimeofday(&time, NULL);
+    return time.tv_sec + time.tv_usec / 1000000.0;
+}
+
+/* Runs Econdensed() to depth on each of the bench positions, starting each
+ * with an empty search hash, and prints the nodes searched and the time
+ * taken
+ */
+void search_benchmark(int depth)
+{
+    int num_fens = sizeof(bench_fens) / sizeof(bench_fens[0]);
+    uint64_t nodes = 0;
+    uint64_t qnodes = 0;
+    double seconds = 0;
+    int i;
+    for (i = 0; i < num_fens; ++i)
+    {
+        Board board;
+        char fen[FEN_SIZE];
+        strcpy(fen, bench_fens[i]);
+        load_fen(&board, fen);
+        set_search_hash(search_hash_megabytes);
+        printf("%s\n", bench_fens[i]);
+        double start = now();
+        Econdensed(&board, depth, 1);
+        seconds += now() - start;
+        nodes += search_nodes;
+        qnodes += quiescence_nodes;
+    }
+    printf("%d positions to depth %d: %lu nodes + %lu quiescence nodes in "
+            "%.3f seconds (%.0f nps)\n", num_fens, depth, (unsigned long)nodes,
+            (unsigned long)qnodes, seconds,
+            (seconds > 0) ? (nodes + qnodes) / seconds : 0.0);
 }
@@ -0,0 +1,5 @@
+#include <stdint.h>
+#include "geometry.h"
+
+/* Written by tools/gen_geometry.c into the object directory at build time */
+#include "geometry_tables.h"
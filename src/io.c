@@ -105,6 +105,16 @@ void print_board(Board* board)
     printf("\n");
 }
 
+/* Prints a move in coordinate notation, such as e2e4 or a7a8q */
+void print_move(PackedMove move)
+{
+    const char promotions[6] = {0, 'b', 'n', 'r', 'q', 0};
+    printf("%c%d%c%d", MOVE_SRC(move) % 8 + 'a', 8 - MOVE_SRC(move) / 8,
+            MOVE_DEST(move) % 8 + 'a', 8 - MOVE_DEST(move) / 8);
+    if (MOVE_PROMOTION(move))
+        printf("%c", promotions[MOVE_PROMOTION(move)]);
+}
+
 /* Prints the ascii representation of the passed piece to the board. It will
  * take up 5 collumns and 3 rows
  */
@@ -155,8 +165,9 @@ void print_piece(uint8_t piece)
 /* Prints the board using ascii pieces and shows the current names of the 
  * players along with their material scores.
  */
-void print_fancy(Board* board)
+void print_fancy(Game* game)
 {
+    Board* board = &game->board;
     int i;
     printf("   \u2554");
     for (i = 0; i < 56; ++i)
@@ -166,7 +177,7 @@ void print_fancy(Board* board)
     int black_score[6];
     const char* piece_chars = "pbnrq";
     get_material_scores(board, white_score, black_score);
-    printf(" %s: ", board->black_name);
+    printf(" %s: ", game->black_name);
     if (white_score[0] - black_score[0] < 0)
         printf("%+d ", black_score[0] - white_score[0]);
     int j;
@@ -190,7 +201,7 @@ void print_fancy(Board* board)
     for (i = 0; i < 56; ++i)
         printf("\u2550");
     printf("\u255d");
-    printf(" %s: ", board->white_name);
+    printf(" %s: ", game->white_name);
     if (white_score[0] - black_score[0] > 0)
         printf("%+d ", white_score[0] - black_score[0]);
     for (i = 1; i < 6; ++i)
@@ -226,8 +237,9 @@ void print_fancy(Board* board)
 }
 
 /* Prints the fancy version of the board, but from black's perspective */
-void print_fancy_flipped(Board* board)
+void print_fancy_flipped(Game* game)
 {
+    Board* board = &game->board;
     int i;
 
     printf("   \u2554");
@@ -238,7 +250,7 @@ void print_fancy_flipped(Board* board)
     int black_score[6];
     const char* piece_chars = "pbnrq";
     get_material_scores(board, white_score, black_score);
-    printf(" %s: ", board->white_name);
+    printf(" %s: ", game->white_name);
     if (white_score[0] - black_score[0] > 0)
         printf("%+d ", white_score[0] - black_score[0]);
     int j;
@@ -261,7 +273,7 @@ void print_fancy_flipped(Board* board)
     for (i = 0; i < 56; ++i)
         printf("\u2550");
     printf("\u255d");
-    printf(" %s: ", board->black_name);
+    printf(" %s: ", game->black_name);
     if (white_score[0] - black_score[0] < 0)
         printf("%+d ", black_score[0] - white_score[0]);
     for (i = 1; i < 6; ++i)
@@ -386,34 +398,34 @@ void load_fen(Board* board, char* fen)
     while (curr_char)
     {
         if (curr_char == 'p')
-            board->position[square_ind++] = PAWN   | BLACK;
+            set_square(board, square_ind++, PAWN   | BLACK);
         else if (curr_char == 'b')
-            board->position[square_ind++] = BISHOP | BLACK;
+            set_square(board, square_ind++, BISHOP | BLACK);
         else if (curr_char == 'n')
-            board->position[square_ind++] = KNIGHT | BLACK;
+            set_square(board, square_ind++, KNIGHT | BLACK);
         else if (curr_char == 'r')
-            board->position[square_ind++] = ROOK   | BLACK;
+            set_square(board, square_ind++, ROOK   | BLACK);
         else if (curr_char == 'q')
-            board->position[square_ind++] = QUEEN  | BLACK;
+            set_square(board, square_ind++, QUEEN  | BLACK);
         else if (curr_char == 'k')
         {
             board->bking_pos = square_ind;
-            board->position[square_ind++] = KING   | BLACK;
+            set_square(board, square_ind++, KING   | BLACK);
         }
         else if (curr_char == 'P')
-            board->position[square_ind++] = PAWN   | WHITE;
+            set_square(board, square_ind++, PAWN   | WHITE);
         else if (curr_char == 'B')   
-            board->position[square_ind++] = BISHOP | WHITE;
+            set_square(board, square_ind++, BISHOP | WHITE);
         else if (curr_char == 'N')   
-            board->position[square_ind++] = KNIGHT | WHITE;
+            set_square(board, square_ind++, KNIGHT | WHITE);
         else if (curr_char == 'R')   
-            board->position[square_ind++] = ROOK   | WHITE;
+            set_square(board, square_ind++, ROOK   | WHITE);
         else if (curr_char == 'Q')   
-            board->position[square_ind++] = QUEEN  | WHITE;
+            set_square(board, square_ind++, QUEEN  | WHITE);
         else if (curr_char == 'K')   
         {
             board->wking_pos = square_ind;
-            board->position[square_ind++] = KING   | WHITE;
+            set_square(board, square_ind++, KING   | WHITE);
         }
         else if (curr_char <= '9' && curr_char >= '0')
             square_ind += curr_char - '0';
@@ -456,6 +468,7 @@ void load_fen(Board* board, char* fen)
 
     token = strtok(NULL, " ");
     board->moves = string_to_int(token);
+    board->hash = position_key(board);
 
     free(fen_copy);
 }
@@ -541,17 +554,17 @@ void export_fen(Board* board, char* fen)
 }
 
 /* Returns a cstring on the heap which contains a PGN of the game */
-char* export_pgn(Board* board)
+char* export_pgn(Game* game)
 {
-    char* pgn = malloc(strlen(board->white_name) + strlen(board->black_name)
-                + 10 * (int)board->history_count + 32);
+    char* pgn = malloc(strlen(game->white_name) + strlen(game->black_name)
+                + 10 * (int)game->history_count + 32);
     int str_ind = 0;
-    str_ind += sprintf(pgn + str_ind, "[White \"%s\"]\n", board->white_name);
-    str_ind += sprintf(pgn + str_ind, "[Black \"%s\"]\n", board->black_name);
+    str_ind += sprintf(pgn + str_ind, "[White \"%s\"]\n", game->white_name);
+    str_ind += sprintf(pgn + str_ind, "[Black \"%s\"]\n", game->black_name);
     int i;
-    for (i = 0; i < board->history_count; ++i)
+    for (i = 0; i < game->history_count; ++i)
     {
-        Move record = board->history[i];
+        Move record = game->history[i];
         if (i % 2 == 0)
             str_ind += sprintf(pgn + str_ind, "%d. ", i / 2 + 1);
         if (record.src_piece & KING)
@@ -596,7 +609,7 @@ char* export_pgn(Board* board)
         if (record.game_over & CHECKMATE)
         {
             str_ind += sprintf(pgn + str_ind, "#");
-            if (board->to_move)
+            if (game->board.to_move)
                 str_ind += sprintf(pgn + str_ind, " 1-0");
             else
                 str_ind += sprintf(pgn + str_ind, " 0-1");
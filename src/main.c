@@ -6,6 +6,9 @@
 #include <sys/time.h>
 #include "chessterm.h"
 #include "engine.h"
+#include "bitboard.h"
+#include "perft.h"
+#include "scan.h"
 #include "settings.h"
 
 #ifdef DEBUG
@@ -19,17 +22,19 @@ void play_stockfish(Engine* engine);
 int engine_v_stockfish(Engine* engine, int silent, FILE* fp);
 int engine_v_engine(char* fen, int silent);
 void thousand_games(Engine* white_engine, Engine* black_engine);
-void initialize_white(int* i, int argc, char** argv, Board* board, Engine*
+void initialize_white(int* i, int argc, char** argv, Game* game, Engine*
         engine, int* bools);
-void initialize_black(int* i, int argc, char** argv, Board* board, Engine*
+void initialize_black(int* i, int argc, char** argv, Game* game, Engine*
         engine, int* bools);
-void prand(Board* board, Engine* white_engine, Engine* black_engine);
-void sanity_check(Board* board, Engine* engine);
+void prand(Game* game, Engine* white_engine, Engine* black_engine);
+void sanity_check(Game* game, Engine* engine);
 
 
 int main(int argc, char** argv)
 {
     srand(time(0));
+    init_bitboards();
+    init_zobrist();
     
     /* Each bit will correlate to a boolean:
      * 0x80000000 stop, can check bools < 0
@@ -38,8 +43,6 @@ int main(int argc, char** argv)
      * 0x04 is stalemate
      * 0x08 is 50 move rule
      * 0x10 is is threefold repitition
-     * 0x20 is MAX_HISTORY
-     * 0x40 is MAX_STORED_POSITIONS
      * 
      * 0x100 is autoflipping
      * 0x200 was an engine assigned a side randomly
@@ -50,13 +53,15 @@ int main(int argc, char** argv)
      * Stop bit should be set to stop the program, should be 0 while running
      */
     int bools = 0;
+    /* The exit status, how many positions failed the last perft suite run */
+    int status = 0;
     #ifdef AUTOFLIP
         if (AUTOFLIP)
             bools |= AUTOFLIP;
     #endif
 
-    Board board;
-    default_board(&board); 
+    Game game;
+    default_game(&game); 
     Engine white_engine;
     white_engine.pid = 0;
     Engine black_engine;
@@ -69,17 +74,51 @@ int main(int argc, char** argv)
             char flag = argv[i][1];
             if (flag == 'f' || flag == 'F')
             {
-                load_fen(&board, argv[++i]);
+                load_fen(&game.board, argv[++i]);
                 continue;
             }
             else if (flag == 'w' || flag == 'W')
             {
-                initialize_white(&i, argc, argv, &board, &white_engine, &bools);
+                initialize_white(&i, argc, argv, &game, &white_engine, &bools);
                 continue;
             }
             else if (flag == 'b' || flag == 'B')
             {
-                initialize_black(&i, argc, argv, &board, &black_engine, &bools);
+                initialize_black(&i, argc, argv, &game, &black_engine, &bools);
+                continue;
+            }
+            else if (flag == 'p' || flag == 'P')
+            {
+                run_perft(&game.board, atoi(argv[++i]));
+                bools |= STOP;
+                continue;
+            }
+            else if (flag == 'd' || flag == 'D')
+            {
+                uint64_t nodes = divide(&game.board, atoi(argv[++i]));
+                printf("Nodes: %lu\n", (unsigned long)nodes);
+                bools |= STOP;
+                continue;
+            }
+            else if (flag == 's' || flag == 'S')
+            {
+                status = perft_suite();
+                bools |= STOP;
+                continue;
+            }
+            else if (flag == 't' || flag == 'T')
+            {
+                set_perft_threads(atoi(argv[++i]));
+                continue;
+            }
+            else if (flag == 'm' || flag == 'M')
+            {
+                set_perft_hash(atoi(argv[++i]));
+                continue;
+            }
+            else if (flag == 'h' || flag == 'H')
+            {
+                set_search_hash(atoi(argv[++i]));
                 continue;
             }
             else if (flag == 'r' || flag == 'R')
@@ -88,16 +127,16 @@ int main(int argc, char** argv)
                 if (black_engine.pid)
                 {
                     if (!white_engine.pid){
-                        initialize_white(&i, argc, argv, &board, &white_engine, &bools);
+                        initialize_white(&i, argc, argv, &game, &white_engine, &bools);
                     }
                 }
                 else if (!white_engine.pid && temp)
                 {
-                    initialize_white(&i, argc, argv, &board, &white_engine, &bools);
+                    initialize_white(&i, argc, argv, &game, &white_engine, &bools);
                 }
                 else
                 {
-                    initialize_black(&i, argc, argv, &board, &black_engine, &bools);
+                    initialize_black(&i, argc, argv, &game, &black_engine, &bools);
                 }
                 continue;
             }
@@ -110,15 +149,15 @@ int main(int argc, char** argv)
 
     printf("\n");
     if (!(bools & STOP))
-        print_fancy(&board);
+        print_fancy(&game);
 
-    bools |= is_gameover(&board);
+    bools |= is_gameover(&game);
     while (!(bools & STOP))
     {
         
         /* If human move */
-        if (( board.to_move && !black_engine.pid) || 
-            (!board.to_move && !white_engine.pid) || 
+        if (( game.board.to_move && !black_engine.pid) || 
+            (!game.board.to_move && !white_engine.pid) || 
             (bools & COMMAND))
         {
             char move[50];
@@ -132,19 +171,19 @@ int main(int argc, char** argv)
             }
             else if (!strcmp(move, "status"))
             {
-                board_stats(&board);
+                board_stats(&game.board);
                 continue;
             }
             else if (!strcmp(move, "fen"))
             {
                 char fen[FEN_SIZE];
-                export_fen(&board, fen);
+                export_fen(&game.board, fen);
                 printf("%s\n", fen);
                 continue;
             }
             else if (!strcmp(move, "pgn"))
             {
-                char* pgn = export_pgn(&board);
+                char* pgn = export_pgn(&game);
                 printf("%s\n", pgn);
                 free(pgn);
                 continue;
@@ -153,9 +192,9 @@ int main(int argc, char** argv)
             {
                 bools ^= 1;
                 if (bools & 1)
-                    print_fancy_flipped(&board);
+                    print_fancy_flipped(&game);
                 else
-                    print_fancy(&board);
+                    print_fancy(&game);
                 continue;
             }
             else if (!strcmp(move, "autoflip"))
@@ -175,7 +214,8 @@ int main(int argc, char** argv)
                     if (AUTOFLIP)
                         bools |= AUTOFLIP;
                 #endif
-                default_board(&board);
+                free_game(&game);
+                default_game(&game);
                 if (bools & RANDOMSIDE)
                 {
                     int temp = rand()%2;
@@ -187,12 +227,12 @@ int main(int argc, char** argv)
                 }
                 if (white_engine.pid){
                     send_ucinewgame(white_engine.write);
-                    memcpy(board.white_name, white_engine.name, 
+                    memcpy(game.white_name, white_engine.name, 
                            strlen(white_engine.name) + 1);
                 }
                 if (black_engine.pid){
                     send_ucinewgame(black_engine.write);
-                    memcpy(board.black_name, black_engine.name, 
+                    memcpy(game.black_name, black_engine.name, 
                            strlen(black_engine.name) + 1);
                 }
             }
@@ -208,12 +248,97 @@ int main(int argc, char** argv)
             }
             else if (!strcmp(move, "prand"))
             {
-                prand(&board, &white_engine, &black_engine);
+                prand(&game, &white_engine, &black_engine);
+                continue;
+            }
+            else if (!strcmp(move, "perft") || !strcmp(move, "divide"))
+            {
+                int depth;
+                if (scanf("%d", &depth) != 1)
+                {
+                    printf("Usage: %s depth\n", move);
+                    scanf("%*s");
+                    continue;
+                }
+                if (!strcmp(move, "perft"))
+                    run_perft(&game.board, depth);
+                else
+                    printf("Nodes: %lu\n",
+                           (unsigned long)divide(&game.board, depth));
+                continue;
+            }
+            else if (!strcmp(move, "perftsuite"))
+            {
+                status = perft_suite();
+                continue;
+            }
+            else if (!strcmp(move, "benchscan"))
+            {
+                scan_benchmark();
+                continue;
+            }
+            else if (!strcmp(move, "benchsearch"))
+            {
+                int depth;
+                if (scanf("%d", &depth) != 1)
+                {
+                    printf("Usage: benchsearch depth\n");
+                    scanf("%*s");
+                    continue;
+                }
+                search_benchmark(depth);
+                continue;
+            }
+            else if (!strcmp(move, "perftthreads") ||
+                     !strcmp(move, "perfthash"))
+            {
+                int value;
+                if (scanf("%d", &value) != 1)
+                {
+                    printf("Usage: %s %s\n", move,
+                           (!strcmp(move, "perfthash")) ? "MB" : "threads");
+                    scanf("%*s");
+                    continue;
+                }
+                if (!strcmp(move, "perfthash"))
+                    set_perft_hash(value);
+                else
+                    set_perft_threads(value);
+                continue;
+            }
+            else if (!strcmp(move, "nullmove") || !strcmp(move, "lmr") ||
+                     !strcmp(move, "futility"))
+            {
+                int on;
+                if (scanf("%d", &on) != 1)
+                {
+                    printf("Usage: %s 0|1\n", move);
+                    scanf("%*s");
+                    continue;
+                }
+                if (!strcmp(move, "nullmove"))
+                    set_search_pruning(PRUNE_NULL_MOVE, on);
+                else if (!strcmp(move, "lmr"))
+                    set_search_pruning(PRUNE_LMR, on);
+                else
+                    set_search_pruning(PRUNE_FUTILITY, on);
+                continue;
+            }
+            else if (!strcmp(move, "hash"))
+            {
+                int megabytes;
+                if (scanf("%d", &megabytes) != 1)
+                {
+                    printf("Usage: hash MB\n");
+                    scanf("%*s");
+                    continue;
+                }
+                set_search_hash(megabytes);
                 continue;
             }
        
             /* Autoflip */
-            if (!move_san(&board, move) && bools & AUTOFLIP)
+            if (!move_san(&game, move) && bools & AUTOFLIP)
             {
                 bools ^= 1;
             }
@@ -222,21 +347,21 @@ int main(int argc, char** argv)
         else
         {
             Move engine_move;
-            if (board.to_move)
+            if (game.board.to_move)
             {
-                engine_move = get_engine_move(&board, &black_engine);
+                engine_move = get_engine_move(&game.board, &black_engine);
             }
             else
             {
-                engine_move = get_engine_move(&board, &white_engine);
+                engine_move = get_engine_move(&game.board, &white_engine);
             }
             
             /* Autoflip */
-            i = move_piece(&board, &engine_move);
+            i = move_piece(&game, &engine_move);
             if (i == -1)
             {
-                print_debug("%d to play\n", board.to_move);
-                print_debug("Move: %d Trying %c%d to %c%d\n", board.moves,
+                print_debug("%d to play\n", game.board.to_move);
+                print_debug("Move: %d Trying %c%d to %c%d\n", game.board.moves,
                         engine_move.src_file + 'a' , engine_move.src_rank + 1, 
                         engine_move.dest%8+'a', 8-engine_move.dest/8);
             }
@@ -248,13 +373,13 @@ int main(int argc, char** argv)
         }
 
         if (bools & 1)
-            print_fancy_flipped(&board);
+            print_fancy_flipped(&game);
         else
-            print_fancy(&board);
+            print_fancy(&game);
 
-        bools |= is_gameover(&board);
+        bools |= is_gameover(&game);
         
-        if (bools & (CHECKMATE | FIFTY | STALEMATE | THREEFOLD | MAXHIST | MAXPOS))
+        if (bools & (CHECKMATE | FIFTY | STALEMATE | THREEFOLD))
         {
             bools |= COMMAND;
             if (bools & CHECKMATE)
@@ -269,7 +394,7 @@ int main(int argc, char** argv)
                     printf("Three fold repetition\n");
                 printf("Stalemate!\n");
             }
-            char* pgn = export_pgn(&board);
+            char* pgn = export_pgn(&game);
             printf("%s\n", pgn);
             free(pgn);
 
@@ -281,15 +406,16 @@ int main(int argc, char** argv)
         stop_engine(&white_engine);
     if (black_engine.pid)
         stop_engine(&black_engine);
-    return 0;
+    free_game(&game);
+    return status;
 }
 
 /* Prints the most recent move to the screen as if it were a part of a PGN */
-void print_last_move(Board* board)
+void print_last_move(Game* game)
 {
-    Move record = board->history[board->history_count - 1];
-    if (board->history_count % 2)
-        dprintf(2 , "%d. ", board->history_count / 2 + 1);
+    Move record = game->history[game->history_count - 1];
+    if (game->history_count % 2)
+        dprintf(2 , "%d. ", game->history_count / 2 + 1);
     if (record.src_piece & KING)
         dprintf(2 , "K");
     if (record.src_piece & QUEEN)
@@ -332,7 +458,7 @@ void print_last_move(Board* board)
     if (record.game_over == 1)
     {
         dprintf(2 , "#");
-        if (board->to_move)
+        if (game->board.to_move)
             dprintf(2 , " 1-0");
         else
             dprintf(2 , " 0-1");
@@ -349,60 +475,63 @@ void print_last_move(Board* board)
 int engine_v_engine(char* fen, int silent)
 {
     int running = 1;
-    Board board;
+    Game game;
     if (fen != NULL)
-        load_fen(&board, fen);
+    {
+        empty_game(&game);
+        load_fen(&game.board, fen);
+    }
     else
-        default_board(&board);
-    memcpy(board.black_name, "My Engine\0", 10);
-    memcpy(board.white_name, "My Engine\0", 10);
+        default_game(&game);
+    memcpy(game.black_name, "My Engine\0", 10);
+    memcpy(game.white_name, "My Engine\0", 10);
     int game_win = -2;
     while (running)
     {
         Move engine_move;
-        if (board.to_move)
-            engine_move = Emateinone(&board);
+        if (game.board.to_move)
+            engine_move = Emateinone(&game.board);
         else
-            engine_move = Econdensed(&board, 4);
+            engine_move = Econdensed(&game.board, 6, !silent);
 
         /*
-        if (board.history_count%2 == 0)
-            print_debug("%d.\n", board.moves);
+        if (game.history_count%2 == 0)
+            print_debug("%d.\n", game.board.moves);
         else
-            print_debug("%d. ...\n", board.moves);
-        print_board(&board);
+            print_debug("%d. ...\n", game.board.moves);
+        print_board(&game.board);
         */
 
-        int valid = move_piece(&board, &engine_move);
+        int valid = move_piece(&game, &engine_move);
 
         if (valid == -1)
         {
 
-            print_debug("%d to play\n", board.to_move);
-            print_debug("Move: %d Trying %c%d to %c%d\n", board.moves,
+            print_debug("%d to play\n", game.board.to_move);
+            print_debug("Move: %d Trying %c%d to %c%d\n", game.board.moves,
                     engine_move.src_file + 'a' , engine_move.src_rank + 1, 
                     engine_move.dest%8+'a', 8-engine_move.dest/8);
         }
-        game_win = is_gameover(&board);
+        game_win = is_gameover(&game);
 
         /*
         if (!valid)
         {
             if (silent)
-                print_last_move(&board);
+                print_last_move(&game);
             if (game_win && silent)
                 dprintf(2, "\n\n");
         }
         */
 
         if (game_win && !silent)
-            print_fancy(&board);
+            print_fancy(&game);
         if (game_win == 2)
         {
             if (!silent)
             {
                 printf("Checkmate!\n");
-                char* pgn = export_pgn(&board);
+                char* pgn = export_pgn(&game);
                 printf("%s\n", pgn);
                 free(pgn);
             }
@@ -417,16 +546,17 @@ int engine_v_engine(char* fen, int silent)
                 else if (game_win == 0x10)
                     printf("Three fold repetition\n");
                 printf("Stalemate!\n");
-                char* pgn = export_pgn(&board);
+                char* pgn = export_pgn(&game);
                 printf("%s\n", pgn);
                 free(pgn);
             }
             running = 0;
         }
     }
-    if (game_win == 2 && board.to_move)
+    free_game(&game);
+    if (game_win == 2 && game.board.to_move)
         return 1;
-    else if (game_win == 2 && !board.to_move)
+    else if (game_win == 2 && !game.board.to_move)
         return -1;
     else if (game_win > 2)
         return 0;
@@ -439,25 +569,28 @@ void play_engine(char* fen)
 {
     int running = 1;
     int flipped = 0;
-    Board board;
+    Game game;
     if (fen != NULL)
-        load_fen(&board, fen);
+    {
+        empty_game(&game);
+        load_fen(&game.board, fen);
+    }
     else
-        default_board(&board);
-    memcpy(board.black_name, "My Engine\0", 10);
+        default_game(&game);
+    memcpy(game.black_name, "My Engine\0", 10);
     printf("\n");
-    print_fancy(&board);
+    print_fancy(&game);
     while (running)
     {
-        if (board.to_move)
+        if (game.board.to_move)
         {
-            //Move engine_move = Erandom_move(&board);
-            //Move engine_move = Eaggressive_move(&board);
-            //Move engine_move = Eape_move(&board);
-            //Move engine_move = Eideal(&board);
-            Move engine_move = Econdensed(&board, 3);
+            //Move engine_move = Erandom_move(&game.board);
+            //Move engine_move = Eaggressive_move(&game.board);
+            //Move engine_move = Eape_move(&game.board);
+            //Move engine_move = Eideal(&game.board);
+            Move engine_move = Econdensed(&game.board, 5, 0);
 
-            move_piece(&board, &engine_move);
+            move_piece(&game, &engine_move);
         }
         else
         {
@@ -471,19 +604,19 @@ void play_engine(char* fen)
             }
             else if (!strcmp(move, "status"))
             {
-                board_stats(&board);
+                board_stats(&game.board);
                 continue;
             }
             else if (!strcmp(move, "fen"))
             {
                 char fen[FEN_SIZE];
-                export_fen(&board, fen);
+                export_fen(&game.board, fen);
                 printf("%s\n", fen);
                 continue;
             }
             else if (!strcmp(move, "pgn"))
             {
-                char* pgn = export_pgn(&board);
+                char* pgn = export_pgn(&game);
                 printf("%s\n", pgn);
                 free(pgn);
                 continue;
@@ -492,26 +625,26 @@ void play_engine(char* fen)
             {
                 flipped = !flipped;
                 if (flipped)
-                    print_fancy_flipped(&board);
+                    print_fancy_flipped(&game);
                 else
-                    print_fancy(&board);
+                    print_fancy(&game);
                 continue;
             }
-            move_san(&board, move);
+            move_san(&game, move);
 
         }
         if (flipped)
-            print_fancy_flipped(&board);
+            print_fancy_flipped(&game);
         else
-            print_fancy(&board);
-        int game_win = is_gameover(&board);
+            print_fancy(&game);
+        int game_win = is_gameover(&game);
         if (game_win)
-            print_fancy(&board);
+            print_fancy(&game);
         if (game_win == 2)
         {
             printf("Checkmate!\n");
             running = 0;
-            char* pgn = export_pgn(&board);
+            char* pgn = export_pgn(&game);
             printf("%s\n", pgn);
             free(pgn);
         }
@@ -519,11 +652,12 @@ void play_engine(char* fen)
         {
             printf("Stalemate!\n");
             running = 0;
-            char* pgn = export_pgn(&board);
+            char* pgn = export_pgn(&game);
             printf("%s\n", pgn);
             free(pgn);
         }
     }
+    free_game(&game);
 }
 
 /* Play a game against the loaded engine. It does not have to be stockfish, even
@@ -533,68 +667,68 @@ void play_engine(char* fen)
 int engine_v_stockfish(Engine* engine, int silent, FILE* fp)
 {
     int running = 1;
-    Board board;
-    default_board(&board);
+    Game game;
+    default_game(&game);
     send_ucinewgame(engine->write);
-    memcpy(board.black_name, engine->name, strlen(engine->name) + 1);
-    memcpy(board.white_name, "My Engine\0", 10);
+    memcpy(game.black_name, engine->name, strlen(engine->name) + 1);
+    memcpy(game.white_name, "My Engine\0", 10);
     int game_win = -2;
     while (running)
     {
         Move engine_move;
-        if (board.to_move)
-            engine_move = get_engine_move(&board, engine);
+        if (game.board.to_move)
+            engine_move = get_engine_move(&game.board, engine);
         else
-            engine_move = Econdensed(&board, 4);
+            engine_move = Econdensed(&game.board, 6, !silent);
 
         /*
-        char* pgn = export_pgn(&board);
+        char* pgn = export_pgn(&game);
         printf("%s\n", pgn);
         free(pgn);
         */
 
         /*
-        if (board.history_count%2 == 0)
-            print_debug("%d.\n", board.moves);
+        if (game.history_count%2 == 0)
+            print_debug("%d.\n", game.board.moves);
         else
-            print_debug("%d. ...\n", board.moves);
-        print_board(&board);
+            print_debug("%d. ...\n", game.board.moves);
+        print_board(&game.board);
         */
 
-        int valid = move_piece(&board, &engine_move);
-        print_fancy(&board);
+        int valid = move_piece(&game, &engine_move);
+        print_fancy(&game);
         char fen[FEN_SIZE];
-        export_fen(&board, fen);
+        export_fen(&game.board, fen);
         printf("%s\n", fen);
 
         if (valid == -1)
         {
 
-            print_debug("%d to play\n", board.to_move);
-            print_debug("Move: %d Trying %c%d to %c%d\n", board.moves,
+            print_debug("%d to play\n", game.board.to_move);
+            print_debug("Move: %d Trying %c%d to %c%d\n", game.board.moves,
                     engine_move.src_file + 'a' , engine_move.src_rank + 1, 
                     engine_move.dest%8+'a', 8-engine_move.dest/8);
         }
-        game_win = is_gameover(&board);
+        game_win = is_gameover(&game);
 
         /*
         if (!valid)
         {
             if (silent)
-                print_last_move(&board);
+                print_last_move(&game);
             if (game_win && silent)
                 dprintf(2, "\n\n");
         }
         */
 
         if (game_win && !silent)
-            print_fancy(&board);
+            print_fancy(&game);
         if (game_win == 2)
         {
             if (!silent)
             {
                 printf("Checkmate!\n");
-                char* pgn = export_pgn(&board);
+                char* pgn = export_pgn(&game);
                 printf("%s\n", pgn);
                 free(pgn);
             }
@@ -609,7 +743,7 @@ int engine_v_stockfish(Engine* engine, int silent, FILE* fp)
                 else if (game_win == 0x10)
                     printf("Three fold repetition\n");
                 printf("Stalemate!\n");
-                char* pgn = export_pgn(&board);
+                char* pgn = export_pgn(&game);
                 printf("%s\n", pgn);
                 free(pgn);
             }
@@ -618,7 +752,7 @@ int engine_v_stockfish(Engine* engine, int silent, FILE* fp)
     }
     if (silent && fp)
     {
-        char* pgn = export_pgn(&board);
+        char* pgn = export_pgn(&game);
         if (fprintf(fp, "%s\n\n", pgn) < 0)
         {
             perror("Couldn't write to file");
@@ -626,9 +760,10 @@ int engine_v_stockfish(Engine* engine, int silent, FILE* fp)
         }
         free(pgn);
     }
-    if (game_win == 2 && board.to_move)
+    free_game(&game);
+    if (game_win == 2 && game.board.to_move)
         return 1;
-    else if (game_win == 2 && !board.to_move)
+    else if (game_win == 2 && !game.board.to_move)
         return -1;
     else if (game_win > 2)
         return 0;
@@ -641,17 +776,17 @@ void play_stockfish(Engine* engine)
 {
     int running = 1;
     int flipped = 0;
-    Board board;
-    default_board(&board);
-    memcpy(board.black_name, engine->name, strlen(engine->name) + 1);
+    Game game;
+    default_game(&game);
+    memcpy(game.black_name, engine->name, strlen(engine->name) + 1);
     printf("\n");
-    print_fancy(&board);
+    print_fancy(&game);
     while (running)
     {
-        if (board.to_move)
+        if (game.board.to_move)
         {
-            Move engine_move = get_engine_move(&board, engine);
-            move_piece(&board, &engine_move);
+            Move engine_move = get_engine_move(&game.board, engine);
+            move_piece(&game, &engine_move);
         }
         else
         {
@@ -665,19 +800,19 @@ void play_stockfish(Engine* engine)
             }
             else if (!strcmp(move, "status"))
             {
-                board_stats(&board);
+                board_stats(&game.board);
                 continue;
             }
             else if (!strcmp(move, "fen"))
             {
                 char fen[FEN_SIZE];
-                export_fen(&board, fen);
+                export_fen(&game.board, fen);
                 printf("%s\n", fen);
                 continue;
             }
             else if (!strcmp(move, "pgn"))
             {
-                char* pgn = export_pgn(&board);
+                char* pgn = export_pgn(&game);
                 printf("%s\n", pgn);
                 free(pgn);
                 continue;
@@ -686,26 +821,26 @@ void play_stockfish(Engine* engine)
             {
                 flipped = !flipped;
                 if (flipped)
-                    print_fancy_flipped(&board);
+                    print_fancy_flipped(&game);
                 else
-                    print_fancy(&board);
+                    print_fancy(&game);
                 continue;
             }
-            move_san(&board, move);
+            move_san(&game, move);
 
         }
         if (flipped)
-            print_fancy_flipped(&board);
+            print_fancy_flipped(&game);
         else
-            print_fancy(&board);
-        int game_win = is_gameover(&board);
+            print_fancy(&game);
+        int game_win = is_gameover(&game);
         if (game_win)
-            print_fancy(&board);
+            print_fancy(&game);
         if (game_win == 2)
         {
             printf("Checkmate!\n");
             running = 0;
-            char* pgn = export_pgn(&board);
+            char* pgn = export_pgn(&game);
             printf("%s\n", pgn);
             free(pgn);
         }
@@ -713,11 +848,12 @@ void play_stockfish(Engine* engine)
         {
             printf("Stalemate!\n");
             running = 0;
-            char* pgn = export_pgn(&board);
+            char* pgn = export_pgn(&game);
             printf("%s\n", pgn);
             free(pgn);
         }
     }
+    free_game(&game);
 }
 
 void thousand_games(Engine* white_engine, Engine* black_engine)
@@ -730,47 +866,49 @@ void thousand_games(Engine* white_engine, Engine* black_engine)
     int result = 0;
     clock_t t = clock();
     FILE* games = fopen("thousand_games.txt", "w");
-    Board board;
+    Game game;
+    empty_game(&game);
     for (i = 0; i < 1000; ++i)
     {
         clock_t in_t = clock();
-        default_board(&board);
+        free_game(&game);
+        default_game(&game);
         send_ucinewgame(white_engine->write);
         send_ucinewgame(black_engine->write);
         while (result == 0)
         {
             Move engine_move;
-            if (board.to_move)
+            if (game.board.to_move)
             {
-                engine_move = get_engine_move(&board, black_engine);
+                engine_move = get_engine_move(&game.board, black_engine);
             }
             else
             {
-                engine_move = get_engine_move(&board, white_engine);
+                engine_move = get_engine_move(&game.board, white_engine);
             }
-            valid_move = move_piece(&board, &engine_move);
+            valid_move = move_piece(&game, &engine_move);
             if (valid_move == -1)
             {
-                print_debug("%d to play\n", board.to_move);
-                print_debug("Move: %d Trying %c%d to %c%d\n", board.moves,
+                print_debug("%d to play\n", game.board.to_move);
+                print_debug("Move: %d Trying %c%d to %c%d\n", game.board.moves,
                         engine_move.src_file + 'a' , engine_move.src_rank + 1, 
                         engine_move.dest%8+'a', 8-engine_move.dest/8);
             }
-            result = is_gameover(&board);
+            result = is_gameover(&game);
         }
 
         in_t = clock() - in_t;
         double t_taken = ((double)in_t)/CLOCKS_PER_SEC;
         printf("Time taken for game %d: %f seconds\n", i + 1, t_taken);
-        if (result == 2 && !board.to_move)
+        if (result == 2 && !game.board.to_move)
             black_win++;
-        else if (result == 2 && board.to_move)
+        else if (result == 2 && game.board.to_move)
             white_win++;
         else if (result & 0x1C)
             draw++;
         if (games)
         {
-            char* pgn = export_pgn(&board);
+            char* pgn = export_pgn(&game);
             if (fprintf(games, "%s\n\n", pgn) < 0)
             {
                 perror("Couldn't write to file");
@@ -779,6 +917,7 @@ void thousand_games(Engine* white_engine, Engine* black_engine)
             free(pgn);
         }
     }
+    free_game(&game);
     t = clock() - t;
     double time_taken = ((double)t)/CLOCKS_PER_SEC;
     printf("Time taken: %f seconds\nWhite: %d\nBlack: %d\nDraw: %d\n", 
@@ -788,10 +927,10 @@ void thousand_games(Engine* white_engine, Engine* black_engine)
     stop_engine(black_engine);
 }
 
-void initialize_black(int* i, int argc, char** argv, Board* board, Engine* engine, int* bools)
+void initialize_black(int* i, int argc, char** argv, Game* game, Engine* engine, int* bools)
 {
     start_engine(engine, argv[++(*i)]);
-    memcpy(board->black_name, engine->name, 
+    memcpy(game->black_name, engine->name, 
             strlen(engine->name) + 1);
     send_ucinewgame(engine->write);
     (*i)++;
@@ -823,10 +962,10 @@ void initialize_black(int* i, int argc, char** argv, Board* board, Engine* engin
     }
 }
 
-void initialize_white(int* i, int argc, char** argv, Board* board, Engine* engine, int* bools)
+void initialize_white(int* i, int argc, char** argv, Game* game, Engine* engine, int* bools)
 {
     start_engine(engine, argv[++(*i)]);
-    memcpy(board->white_name, engine->name, 
+    memcpy(game->white_name, engine->name, 
             strlen(engine->name) + 1);
     send_ucinewgame(engine->write);
     (*i)++;
@@ -858,8 +997,9 @@ void initialize_white(int* i, int argc, char** argv, Board* board, Engine* engin
     }
 }
 
-void prand(Board *board, Engine* white_engine, Engine* black_engine)
+void prand(Game* game, Engine* white_engine, Engine* black_engine)
 {
+    Board* board = &game->board;
     /* Threshold is how much better an engine must be before being 
      * nerfed. 
      *
@@ -885,19 +1025,20 @@ void prand(Board *board, Engine* white_engine, Engine* black_engine)
     t_out = (long)timecheck_out.tv_sec * 1000 + (long)timecheck_out.tv_usec / 1000;
     for (i = 0; i < num_games && high > low + 1; ++i)
     {
-        default_board(board);
+        free_game(game);
+        default_game(game);
         if (i & 1)
         {
-            memcpy(&board->white_name, black_engine->name, 
+            memcpy(game->white_name, black_engine->name, 
                    strlen(black_engine->name) + 1);
-            memcpy(&board->black_name, white_engine->name, 
+            memcpy(game->black_name, white_engine->name, 
                    strlen(white_engine->name) + 1);
         }
         else 
         {
-            memcpy(&board->black_name, black_engine->name, 
+            memcpy(game->black_name, black_engine->name, 
                    strlen(black_engine->name) + 1);
-            memcpy(&board->white_name, white_engine->name, 
+            memcpy(game->white_name, white_engine->name, 
                    strlen(white_engine->name) + 1);
         }
         send_ucinewgame(white_engine->write);
@@ -934,7 +1075,7 @@ void prand(Board *board, Engine* white_engine, Engine* black_engine)
                 }
             }
 
-            valid_move = move_piece(board, &engine_move);
+            valid_move = move_piece(game, &engine_move);
             if (valid_move == -1)
             {
                 if (board->to_move ^ (i & 1))
@@ -952,7 +1093,7 @@ void prand(Board *board, Engine* white_engine, Engine* black_engine)
                         engine_move.src_file + 'a' , 8 - engine_move.src_rank, 
                         engine_move.dest%8+'a', 8-engine_move.dest/8);
             }
-            result = is_gameover(board);
+            result = is_gameover(game);
         }
         gettimeofday(&timecheck_in, NULL);
         t_in = (long)timecheck_in.tv_sec * 1000 + (long)timecheck_in.tv_usec / 1000 - t_in;
@@ -966,7 +1107,7 @@ void prand(Board *board, Engine* white_engine, Engine* black_engine)
             draw++;
         if (games)
         {
-            char* pgn = export_pgn(board);
+            char* pgn = export_pgn(game);
             if (fprintf(games, "%s\n\n", pgn) < 0)
             {
                 perror("Couldn't write to file");
@@ -1034,14 +1175,17 @@ void prand(Board *board, Engine* white_engine, Engine* black_engine)
     stop_engine(black_engine);
 }
 
-void sanity_check(Board* board, Engine* engine)
+void sanity_check(Game* game, Engine* engine)
 {
-    Board copy;
+    Board* board = &game->board;
+    Game copy;
+    empty_game(&copy);
     int i;
     for (i = 0; i < 1000; ++i)
     {
-        memcpy(&copy, board, sizeof(Board));
-        Move move = get_engine_move(&copy, engine);
+        copy.board = *board;
+        copy.history_count = 0;
+        Move move = get_engine_move(&copy.board, engine);
         int valid_move = move_piece(&copy, &move);
         if (valid_move == -1)
         {
@@ -1055,4 +1199,5 @@ void sanity_check(Board* board, Engine* engine)
         else
             dprintf(2, "Y\n");
     }
+    free_game(&copy);
 }
@@ -0,0 +1,423 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include "perft.h"
+#include "board.h"
+#include "io.h"
+
+#define MAX_PERFT_THREADS 64
+
+/* A position with its known node count at depth */
+typedef struct
+{
+    const char* fen;
+    int depth;
+    uint64_t nodes;
+} PerftEntry;
+
+/* A position, moves to enter on it one at a time as the player would and
+ * the position they should leave behind. Moves that are not valid are
+ * refused and must leave the board as it was.
+ */
+typedef struct
+{
+    const char* fen;
+    const char* moves;
+    const char* result;
+} MoveEntry;
+
+/* A stored subtree count. data holds the node count above the low 8 bits and
+ * the depth in them. check is the position key xored with data, so an entry
+ * torn by two threads writing at once never matches and no lock is needed.
+ */
+typedef struct
+{
+    uint64_t check;
+    uint64_t data;
+} PerftHashEntry;
+
+/* One worker of the root split. Workers take root moves from the shared
+ * next index until none are left and count the nodes below each on their
+ * own copy of the board.
+ */
+typedef struct
+{
+    pthread_t thread;
+    Board board;
+    PackedMove* moves;
+    uint64_t* counts;
+    int count;
+    int depth;
+    int* next;
+    uint64_t nodes;
+    uint64_t probes;
+    uint64_t hits;
+} PerftThread;
+
+/* Standard test positions covering castling, en passant, promotions and
+ * discovered checks. Depths are kept low enough for the whole suite to run
+ * in a few seconds.
+ */
+static const PerftEntry perft_entries[] =
+{
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+        5, 4865609},
+    {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        4, 4085603},
+    {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+        5, 674624},
+    {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+        4, 422333},
+    {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+        4, 2103487},
+    {"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+        4, 3894594}
+};
+
+/* Move sequences that once left the board in a bad state */
+static const MoveEntry move_entries[] =
+{
+    /* A refused king move while in check, then the block */
+    {"3qk3/8/8/8/8/8/8/4R1K1 b - - 0 1", "Ke7 Qe7",
+        "4k3/4q3/8/8/8/8/8/4R1K1 w - - 1 2"}
+};
+
+/* 0 threads means one per online CPU */
+static int perft_threads = 0;
+static PerftHashEntry* perft_hash = NULL;
+static uint64_t perft_hash_mask = 0;
+
+/* Returns the wall clock time in seconds */
+static double now()
+{
+    struct timeval time;
+    gettimeofday(&time, NULL);
+    return time.tv_sec + time.tv_usec / 1000000.0;
+}
+
+/* Returns nodes per second, guarding against runs too quick to time */
+static uint64_t nps(uint64_t nodes, double seconds)
+{
+    if (seconds <= 0)
+        return 0;
+    return nodes / seconds;
+}
+
+/* Sets how many threads perft splits the root moves across. 0 uses one per
+ * online CPU.
+ */
+void set_perft_threads(int threads)
+{
+    if (threads < 0)
+        threads = 0;
+    if (threads > MAX_PERFT_THREADS)
+        threads = MAX_PERFT_THREADS;
+    perft_threads = threads;
+}
+
+/* Returns how many threads perft will run */
+static int get_perft_threads()
+{
+    if (perft_threads)
+        return perft_threads;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 1)
+        return 1;
+    if (cpus > MAX_PERFT_THREADS)
+        return MAX_PERFT_THREADS;
+    return cpus;
+}
+
+/* Sets the size of the perft hash in megabytes, rounded down to a power of
+ * two number of entries. 0 turns the hash off.
+ */
+void set_perft_hash(int megabytes)
+{
+    free(perft_hash);
+    perft_hash = NULL;
+    perft_hash_mask = 0;
+    if (megabytes <= 0)
+        return;
+    uint64_t entries = 1;
+    while (entries * 2 * sizeof(PerftHashEntry) <= (uint64_t)megabytes << 20)
+        entries *= 2;
+    perft_hash = calloc(entries, sizeof(PerftHashEntry));
+    if (!perft_hash)
+    {
+        printf("Couldn't allocate a %d MB perft hash\n", megabytes);
+        return;
+    }
+    perft_hash_mask = entries - 1;
+}
+
+/* Counts leaf nodes below the board, bulk counting the last ply. Subtrees
+ * two or more plies deep are looked up in and stored to the perft hash.
+ */
+static uint64_t perft_node(Board* board, int depth, PerftThread* thread)
+{
+    if (depth == 0)
+        return 1;
+    PerftHashEntry* entry = NULL;
+    if (perft_hash && depth > 1)
+    {
+        entry = &perft_hash[board->hash & perft_hash_mask];
+        uint64_t check = __atomic_load_n(&entry->check, __ATOMIC_RELAXED);
+        uint64_t data = __atomic_load_n(&entry->data, __ATOMIC_RELAXED);
+        thread->probes++;
+        if ((check ^ data) == board->hash && (int)(data & 0xFF) == depth)
+        {
+            thread->hits++;
+            return data >> 8;
+        }
+    }
+
+    PackedMove moves[MOVES_PER_POSITION];
+    int count = generate_moves(board, moves, GEN_ALL);
+    if (depth == 1)
+        return count;
+    uint64_t nodes = 0;
+    int i;
+    for (i = 0; i < count; ++i)
+    {
+        Undo undo;
+        make_packed_move(board, moves[i], &undo);
+        nodes += perft_node(board, depth - 1, thread);
+        unmake_move(board, &undo);
+    }
+
+    if (entry)
+    {
+        uint64_t data = (nodes << 8) | depth;
+        __atomic_store_n(&entry->check, board->hash ^ data, __ATOMIC_RELAXED);
+        __atomic_store_n(&entry->data, data, __ATOMIC_RELAXED);
+    }
+    return nodes;
+}
+
+static void* perft_worker(void* arg)
+{
+    PerftThread* thread = arg;
+    int i;
+    while ((i = __atomic_fetch_add(thread->next, 1, __ATOMIC_RELAXED))
+            < thread->count)
+    {
+        Undo undo;
+        make_packed_move(&thread->board, thread->moves[i], &undo);
+        thread->counts[i] = perft_node(&thread->board, thread->depth - 1,
+                thread);
+        unmake_move(&thread->board, &undo);
+        thread->nodes += thread->counts[i];
+    }
+    return NULL;
+}
+
+/* Splits the legal moves of the board across the perft threads and fills
+ * counts with the nodes below each of them. threads must have room for
+ * MAX_PERFT_THREADS workers and is left holding each one's statistics.
+ * Returns how many threads were used.
+ */
+static int perft_root(Board* board, int depth, PackedMove* moves,
+        uint64_t* counts, int count, PerftThread* threads)
+{
+    int num_threads = get_perft_threads();
+    int next = 0;
+    int i;
+    for (i = 0; i < num_threads; ++i)
+    {
+        threads[i].board = *board;
+        threads[i].moves = moves;
+        threads[i].counts = counts;
+        threads[i].count = count;
+        threads[i].depth = depth;
+        threads[i].next = &next;
+        threads[i].nodes = 0;
+        threads[i].probes = 0;
+        threads[i].hits = 0;
+    }
+    /* The calling thread works as thread 0 */
+    for (i = 1; i < num_threads; ++i)
+    {
+        if (pthread_create(&threads[i].thread, NULL, perft_worker,
+                    &threads[i]))
+            break;
+    }
+    int started = i;
+    perft_worker(&threads[0]);
+    for (i = 1; i < started; ++i)
+        pthread_join(threads[i].thread, NULL);
+    return started;
+}
+
+/* Adds up the statistics of the threads of a perft_root() run */
+static void perft_totals(PerftThread* threads, int num_threads,
+        uint64_t* nodes, uint64_t* probes, uint64_t* hits)
+{
+    int i;
+    for (i = 0; i < num_threads; ++i)
+    {
+        *nodes += threads[i].nodes;
+        *probes += threads[i].probes;
+        *hits += threads[i].hits;
+    }
+}
+
+/* Prints the hash hit rate, if the hash is on */
+static void print_hash_rate(uint64_t probes, uint64_t hits)
+{
+    if (!perft_hash)
+        return;
+    printf("Hash: %lu hits of %lu probes (%.1f%%)\n", (unsigned long)hits,
+            (unsigned long)probes, (probes) ? 100.0 * hits / probes : 0.0);
+}
+
+/* Returns the number of leaf nodes in the legal move tree of the given depth
+ * on the calling thread. The board is returned to its original state.
+ */
+uint64_t perft(Board* board, int depth)
+{
+    PerftThread thread;
+    thread.probes = 0;
+    thread.hits = 0;
+    return perft_node(board, depth, &thread);
+}
+
+/* Prints the perft count below each legal move and returns the total */
+uint64_t divide(Board* board, int depth)
+{
+    if (depth < 1)
+        return 1;
+    PackedMove moves[MOVES_PER_POSITION];
+    uint64_t counts[MOVES_PER_POSITION];
+    PerftThread threads[MAX_PERFT_THREADS];
+    int count = generate_moves(board, moves, GEN_ALL);
+    int num_threads = perft_root(board, depth, moves, counts, count, threads);
+    uint64_t nodes = 0;
+    uint64_t probes = 0;
+    uint64_t hits = 0;
+    perft_totals(threads, num_threads, &nodes, &probes, &hits);
+    int i;
+    for (i = 0; i < count; ++i)
+    {
+        print_move(moves[i]);
+        printf(": %lu\n", (unsigned long)counts[i]);
+    }
+    print_hash_rate(probes, hits);
+    return nodes;
+}
+
+/* Runs perft on the board and prints the node count, time and speed along
+ * with the nodes each thread counted
+ */
+void run_perft(Board* board, int depth)
+{
+    if (depth < 1)
+    {
+        printf("Depth %d: 1 nodes\n", depth);
+        return;
+    }
+    PackedMove moves[MOVES_PER_POSITION];
+    uint64_t counts[MOVES_PER_POSITION];
+    PerftThread threads[MAX_PERFT_THREADS];
+    double start = now();
+    int count = generate_moves(board, moves, GEN_ALL);
+    int num_threads = perft_root(board, depth, moves, counts, count, threads);
+    double seconds = now() - start;
+    uint64_t nodes = 0;
+    uint64_t probes = 0;
+    uint64_t hits = 0;
+    perft_totals(threads, num_threads, &nodes, &probes, &hits);
+    int i;
+    for (i = 0; i < num_threads; ++i)
+        printf("Thread %d: %lu nodes\n", i, (unsigned long)threads[i].nodes);
+    print_hash_rate(probes, hits);
+    printf("Depth %d: %lu nodes in %.3f seconds (%lu nps)\n", depth,
+            (unsigned long)nodes, seconds,
+            (unsigned long)nps(nodes, seconds));
+}
+
+/* Enters the moves of the entry and checks the position they leave. Prints
+ * a line for it and returns 1 if it failed.
+ */
+static int run_move_entry(const MoveEntry* entry)
+{
+    char fen[FEN_SIZE];
+    char moves[FEN_SIZE];
+    Game game;
+    empty_game(&game);
+    snprintf(fen, FEN_SIZE, "%s", entry->fen);
+    load_fen(&game.board, fen);
+    snprintf(moves, FEN_SIZE, "%s", entry->moves);
+    char* move;
+    for (move = strtok(moves, " "); move; move = strtok(NULL, " "))
+        move_san(&game, move);
+    export_fen(&game.board, fen);
+    free_game(&game);
+
+    int failed = strcmp(fen, entry->result) != 0;
+    printf("%s moves %s: %s", (failed) ? "FAIL" : "PASS", entry->moves, fen);
+    if (failed)
+        printf(" (expected %s)", entry->result);
+    printf("\n     %s\n", entry->fen);
+    return failed;
+}
+
+/* Runs perft on every position of the suite and checks the node counts,
+ * then plays the move sequences and checks where they end up. Prints a line
+ * per entry followed by the totals, and returns the number of entries that
+ * failed.
+ */
+int perft_suite()
+{
+    int num_entries = sizeof(perft_entries) / sizeof(perft_entries[0]);
+    int failed = 0;
+    uint64_t total_nodes = 0;
+    uint64_t probes = 0;
+    uint64_t hits = 0;
+    double total_seconds = 0;
+    int num_threads = 0;
+    int i;
+    for (i = 0; i < num_entries; ++i)
+    {
+        const PerftEntry* entry = &perft_entries[i];
+        char fen[FEN_SIZE];
+        Board board;
+        snprintf(fen, FEN_SIZE, "%s", entry->fen);
+        load_fen(&board, fen);
+
+        PackedMove moves[MOVES_PER_POSITION];
+        uint64_t counts[MOVES_PER_POSITION];
+        PerftThread threads[MAX_PERFT_THREADS];
+        double start = now();
+        int count = generate_moves(&board, moves, GEN_ALL);
+        num_threads = perft_root(&board, entry->depth, moves, counts, count,
+                threads);
+        double seconds = now() - start;
+        uint64_t nodes = 0;
+        perft_totals(threads, num_threads, &nodes, &probes, &hits);
+        total_nodes += nodes;
+        total_seconds += seconds;
+        if (nodes != entry->nodes)
+            failed++;
+
+        printf("%s depth %d: %lu nodes", (nodes == entry->nodes) ?
+                "PASS" : "FAIL", entry->depth, (unsigned long)nodes);
+        if (nodes != entry->nodes)
+            printf(" (expected %lu)", (unsigned long)entry->nodes);
+        printf(" in %.3f seconds\n     %s\n", seconds, entry->fen);
+    }
+    int num_moves = sizeof(move_entries) / sizeof(move_entries[0]);
+    for (i = 0; i < num_moves; ++i)
+        failed += run_move_entry(&move_entries[i]);
+    num_entries += num_moves;
+
+    print_hash_rate(probes, hits);
+    printf("%d of %d passed, %lu nodes in %.3f seconds (%lu nps) on %d %s\n",
+            num_entries - failed, num_entries, (unsigned long)total_nodes,
+            total_seconds, (unsigned long)nps(total_nodes, total_seconds),
+            num_threads, (num_threads == 1) ? "thread" : "threads");
+    return failed;
+}
@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "scan.h"
+#include "board.h"
+#include "bitboard.h"
+
+#ifdef USE_SIMD_ATTACKS
+#include <immintrin.h>
+#endif
+
+#define BENCH_CALLS 5000000
+#define BENCH_POSITIONS 4096
+
+#ifdef USE_SIMD_ATTACKS
+/* Reads the bytes of the board at the 32 squares in index. chunks holds each
+ * 16 bytes of the board in both lanes, so one in-lane shuffle per chunk
+ * reaches every square, and a compare keeps the bytes from the right chunk.
+ */
+static inline __m256i gather_squares(const __m256i* chunks, __m256i index)
+{
+    __m256i chunk_bits = _mm256_and_si256(index, _mm256_set1_epi8((char)0xB0));
+    __m256i result = _mm256_setzero_si256();
+    int k;
+    for (k = 0; k < 4; ++k)
+        result = _mm256_or_si256(result, _mm256_and_si256(
+                    _mm256_shuffle_epi8(chunks[k], index),
+                    _mm256_cmpeq_epi8(chunk_bits, _mm256_set1_epi8(k << 4))));
+    return result;
+}
+
+/* Returns a bit per byte of a and b set where the bytes are equal to piece */
+static inline uint64_t match_pieces(__m256i a, __m256i b, uint8_t piece)
+{
+    __m256i code = _mm256_set1_epi8((char)piece);
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, code))
+         | (uint64_t)(uint32_t)_mm256_movemask_epi8(
+                 _mm256_cmpeq_epi8(b, code)) << 32;
+}
+
+/* Returns non-zero if a piece of color, 0 for white, attacks square in the
+ * position array. All eight rays and the knight squares are read at once,
+ * and the nearest piece on every ray is found together by isolating the
+ * lowest set bit of each byte of the occupancy, without branching.
+ */
+int ray_attacked(const uint8_t* position, int square, int color)
+{
+    const uint64_t low_bits = 0x0101010101010101ULL;
+    const uint64_t high_bits = 0x8080808080808080ULL;
+    uint8_t them = (color) ? BLACK : WHITE;
+    __m256i chunks[4];
+    int k;
+    for (k = 0; k < 4; ++k)
+        chunks[k] = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128((const __m128i*)position + k));
+    /* ray_lists runs along the ranks and files for its first 32 squares and
+     * the diagonals for the rest. Squares past the edge are NO_SQUARE, which
+     * the byte shuffles read as 0.
+     */
+    __m256i lines = gather_squares(chunks,
+            _mm256_loadu_si256((const __m256i*)ray_lists[square]));
+    __m256i diagonals = gather_squares(chunks,
+            _mm256_loadu_si256((const __m256i*)ray_lists[square] + 1));
+    uint64_t knight_list;
+    memcpy(&knight_list, knight_lists[square], sizeof(knight_list));
+    __m256i knights = gather_squares(chunks, _mm256_set_epi64x(
+                0x8080808080808080LL, 0x8080808080808080LL,
+                0x8080808080808080LL, knight_list));
+
+    uint64_t occupied = ~match_pieces(lines, diagonals, 0);
+    uint64_t sliders = (match_pieces(lines, diagonals, QUEEN | them)
+                     | (match_pieces(lines, diagonals, ROOK | them)
+                         & 0x00000000FFFFFFFFULL)
+                     | (match_pieces(lines, diagonals, BISHOP | them)
+                         & 0xFFFFFFFF00000000ULL));
+    /* Pawns attack diagonally forwards, so white pawns are found one square
+     * down the diagonals and black pawns one square up
+     */
+    uint64_t near = match_pieces(lines, diagonals, KING | them) & low_bits;
+    near |= match_pieces(lines, diagonals, PAWN | them)
+          & ((color) ? 0x0000010100000000ULL : 0x0101000000000000ULL);
+    near |= (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(knights,
+                _mm256_set1_epi8((char)(KNIGHT | them))));
+
+    /* occupied & -occupied within each byte */
+    uint64_t negated = ((~occupied & ~high_bits) + low_bits)
+                     ^ (~occupied & high_bits);
+    uint64_t nearest = occupied & negated;
+    return ((nearest & sliders) | near) != 0;
+}
+#endif
+
+/* Returns the wall clock time in seconds */
+static double now()
+{
+    struct timeval time;
+    gettimeofday(&time, NULL);
+    return time.tv_sec + time.tv_usec / 1000000.0;
+}
+
+/* Fills boards with count positions from a random game played from the
+ * starting position, starting it again whenever it ends. The generator has
+ * a fixed seed so every run times the same positions.
+ */
+static void bench_positions(Board* boards, int count)
+{
+    uint64_t seed = 0x2545F4914F6CDD1DULL;
+    Board board;
+    default_board(&board);
+    int i;
+    for (i = 0; i < count; ++i)
+    {
+        PackedMove moves[MOVES_PER_POSITION];
+        Undo undo;
+        int num_moves = generate_moves(&board, moves, GEN_ALL);
+        if (!num_moves || board.halfmoves >= 100)
+        {
+            default_board(&board);
+            num_moves = generate_moves(&board, moves, GEN_ALL);
+        }
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        make_packed_move(&board, moves[seed % num_moves], &undo);
+        boards[i] = board;
+    }
+}
+
+/* Times the ways of asking whether a square is attacked by white: an attack
+ * map built for the position, the same map once it is cached, the attackers
+ * on the bitboards and, when built with USE_SIMD_ATTACKS, the ray scan of
+ * the position array. Each call but the cached ones asks about the next of
+ * BENCH_POSITIONS positions, far more than the attack map cache holds, so
+ * every map has to be built.
+ */
+void scan_benchmark()
+{
+    Board* boards = malloc(BENCH_POSITIONS * sizeof(Board));
+    uint64_t sink = 0;
+    int j;
+    if (!boards)
+        return;
+    bench_positions(boards, BENCH_POSITIONS);
+    double start = now();
+    for (j = 0; j < BENCH_CALLS; ++j)
+        sink += (get_attack_map(&boards[j % BENCH_POSITIONS])->attacked[0]
+                >> (j & 63)) & 1;
+    double built_ns = (now() - start) * 1e9 / BENCH_CALLS;
+    start = now();
+    for (j = 0; j < BENCH_CALLS; ++j)
+        sink += (get_attack_map(&boards[0])->attacked[0] >> (j & 63)) & 1;
+    double cached_ns = (now() - start) * 1e9 / BENCH_CALLS;
+    start = now();
+    for (j = 0; j < BENCH_CALLS; ++j)
+    {
+        Board* board = &boards[j % BENCH_POSITIONS];
+        sink += (attackers_to(board, j & 63,
+                    board->occupied[0] | board->occupied[1])
+                & board->occupied[0]) != 0;
+    }
+    double bitboard_ns = (now() - start) * 1e9 / BENCH_CALLS;
+    printf("is_attacked  attack map %6.2f ns (cached %.2f ns)  "
+            "bitboards %6.2f ns", built_ns, cached_ns, bitboard_ns);
+#ifdef USE_SIMD_ATTACKS
+    start = now();
+    for (j = 0; j < BENCH_CALLS; ++j)
+        sink += ray_attacked(boards[j % BENCH_POSITIONS].position, j & 63, 0);
+    printf("  ray scan %6.2f ns", (now() - start) * 1e9 / BENCH_CALLS);
+#endif
+    printf("%s\n", (sink == 1) ? " " : "");
+    free(boards);
+}
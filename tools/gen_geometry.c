@@ -0,0 +1,183 @@
+/* Prints the board geometry tables declared in include/geometry.h as C
+ * definitions. The Makefile runs it at build time and src/geometry.c
+ * includes its output, so the tables are constant data and nothing has to
+ * be set up when the program starts.
+ */
+#include <stdio.h>
+#include <stdint.h>
+
+#define SQUARE_BB(square) (1ULL << (square))
+
+/* Rank and file steps of the ray directions, in the order of the
+ * RAY_ constants in geometry.h. Square 0 is a8, so up the board is a
+ * negative rank step.
+ */
+static const int ray_steps[8][2] =
+{
+    {-1, 0}, {1, 0}, {0, -1}, {0, 1}, {-1, -1}, {-1, 1}, {1, -1}, {1, 1}
+};
+
+/* The ray pointing the other way to each ray */
+static const int opposite_rays[8] = {1, 0, 3, 2, 7, 6, 5, 4};
+
+static const int knight_steps[8][2] =
+{
+    {-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}
+};
+
+static uint64_t knight_targets[64];
+static uint64_t king_targets[64];
+static uint64_t pawn_targets[2][64];
+static uint64_t ray_masks[8][64];
+static uint8_t ray_lists[64][64];
+static uint8_t knight_lists[64][8];
+static uint64_t between_squares[64][64];
+static uint64_t line_squares[64][64];
+
+/* Returns the square rank and file steps away from square, or -1 if that is
+ * off the board
+ */
+static int step(int square, int ranks, int files)
+{
+    int rank = square / 8 + ranks;
+    int file = square % 8 + files;
+    if (rank < 0 || rank > 7 || file < 0 || file > 7)
+        return -1;
+    return rank * 8 + file;
+}
+
+static void build_tables()
+{
+    int a;
+    int b;
+    int i;
+    int ray;
+    for (a = 0; a < 64; ++a)
+    {
+        for (i = 0; i < 8; ++i)
+        {
+            int target = step(a, knight_steps[i][0], knight_steps[i][1]);
+            knight_lists[a][i] = (target == -1) ? 0x80 : target;
+            if (target != -1)
+                knight_targets[a] |= SQUARE_BB(target);
+            target = step(a, ray_steps[i][0], ray_steps[i][1]);
+            if (target != -1)
+                king_targets[a] |= SQUARE_BB(target);
+        }
+        for (i = -1; i <= 1; i += 2)
+        {
+            int target = step(a, -1, i);
+            if (target != -1)
+                pawn_targets[0][a] |= SQUARE_BB(target);
+            target = step(a, 1, i);
+            if (target != -1)
+                pawn_targets[1][a] |= SQUARE_BB(target);
+        }
+        for (ray = 0; ray < 8; ++ray)
+        {
+            int target = a;
+            for (i = 0; i < 8; ++i)
+            {
+                if (target != -1)
+                    target = step(target, ray_steps[ray][0],
+                            ray_steps[ray][1]);
+                ray_lists[a][ray * 8 + i] = (target == -1) ? 0x80 : target;
+                if (target != -1)
+                    ray_masks[ray][a] |= SQUARE_BB(target);
+            }
+        }
+    }
+
+    /* Two squares share a line when one is on a ray of the other. The
+     * squares between them are the part of that ray before the second, and
+     * the line is that ray and the opposite one through the first square.
+     */
+    for (a = 0; a < 64; ++a)
+    {
+        for (ray = 0; ray < 8; ++ray)
+        {
+            int opposite = opposite_rays[ray];
+            uint64_t between = 0;
+            for (i = 0; i < 8 && ray_lists[a][ray * 8 + i] != 0x80; ++i)
+            {
+                b = ray_lists[a][ray * 8 + i];
+                between_squares[a][b] = between;
+                line_squares[a][b] = ray_masks[ray][a] | ray_masks[opposite][a]
+                                   | SQUARE_BB(a);
+                between |= SQUARE_BB(b);
+            }
+        }
+    }
+}
+
+/* Prints the entries of one row of a table, per_line to a line, each line
+ * starting with indent
+ */
+static void print_row(const char* indent, const uint64_t* row, int size,
+        int per_line, int hex)
+{
+    int i;
+    for (i = 0; i < size; ++i)
+    {
+        printf("%s", (i % per_line) ? " " : indent);
+        if (hex)
+            printf("0x%016llXULL,", (unsigned long long)row[i]);
+        else
+            printf("%3d,", (int)row[i]);
+        if (i % per_line == per_line - 1 || i == size - 1)
+            printf("\n");
+    }
+}
+
+/* Prints a table of rows by columns entries as a C definition. A table with
+ * one row is printed flat, and a table with more gets braces around each
+ * row.
+ */
+static void print_table(const char* type, const char* name, const char* dims,
+        const uint64_t* table, int rows, int columns, int hex)
+{
+    int per_line = (hex) ? 3 : 12;
+    int row;
+    printf("const %s %s%s =\n{\n", type, name, dims);
+    if (rows == 1)
+        print_row("    ", table, columns, per_line, hex);
+    for (row = 0; rows > 1 && row < rows; ++row)
+    {
+        printf("    {\n");
+        print_row("        ", table + row * columns, columns, per_line, hex);
+        printf("    },\n");
+    }
+    printf("};\n\n");
+}
+
+static void print_u64(const char* name, const char* dims, const uint64_t* table,
+        int rows, int columns)
+{
+    print_table("uint64_t", name, dims, table, rows, columns, 1);
+}
+
+static void print_u8(const char* name, const char* dims, const uint8_t* table,
+        int rows, int columns)
+{
+    uint64_t wide[64 * 64];
+    int i;
+    for (i = 0; i < rows * columns; ++i)
+        wide[i] = table[i];
+    print_table("uint8_t", name, dims, wide, rows, columns, 0);
+}
+
+int main()
+{
+    build_tables();
+    printf("/* Generated by tools/gen_geometry.c, do not edit */\n\n");
+    print_u64("knight_targets", "[64]", knight_targets, 1, 64);
+    print_u64("king_targets", "[64]", king_targets, 1, 64);
+    print_u64("pawn_targets", "[2][64]", &pawn_targets[0][0], 2, 64);
+    print_u64("ray_masks", "[8][64]", &ray_masks[0][0], 8, 64);
+    print_u8("ray_lists", "[64][64]", &ray_lists[0][0], 64, 64);
+    print_u8("knight_lists", "[64][8]", &knight_lists[0][0], 64, 8);
+    print_u64("between_squares", "[64][64]", &between_squares[0][0], 64,
+            64);
+    print_u64("line_squares", "[64][64]", &line_squares[0][0], 64, 64);
+    return 0;
+}